@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#pragma once
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <prismspf/config.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+template <unsigned int dim>
+class UserInputParameters;
+
+/**
+ * @brief Class that writes solution output on a background thread.
+ *
+ * The solution vectors are copied into a pool of reusable buffers and the patch building
+ * and file writing happen on a worker thread, so the time loop can keep stepping while
+ * the output is written. The pool is bounded, so when every buffer is waiting to be
+ * written the next output blocks until one is free.
+ *
+ * The worker thread does not communicate, so only the file types that are written
+ * independently by each process (pvtu and vtk) are supported.
+ */
+template <unsigned int dim, typename number>
+class AsyncSolutionOutput
+{
+public:
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<number>;
+
+  /**
+   * @brief Constructor.
+   */
+  explicit AsyncSolutionOutput(const UserInputParameters<dim> &_user_inputs);
+
+  /**
+   * @brief Destructor. This waits for the pending output to be written.
+   */
+  ~AsyncSolutionOutput();
+
+  AsyncSolutionOutput(const AsyncSolutionOutput &)            = delete;
+  AsyncSolutionOutput &operator=(const AsyncSolutionOutput &) = delete;
+  AsyncSolutionOutput(AsyncSolutionOutput &&)                 = delete;
+  AsyncSolutionOutput &operator=(AsyncSolutionOutput &&)      = delete;
+
+  /**
+   * @brief Snapshot the solution set and queue it to be written for the current
+   * increment. This blocks if every buffer is waiting to be written.
+   */
+  void
+  enqueue(const std::map<unsigned int, VectorType *>         &solution_set,
+          const std::vector<const dealii::DoFHandler<dim> *> &dof_handlers,
+          const unsigned int                                 &degree,
+          const std::string                                  &name);
+
+  /**
+   * @brief Wait for the pending output to be written. This must be called before the
+   * DoFHandlers change, for example before grid refinement.
+   */
+  void
+  wait();
+
+private:
+  /**
+   * @brief An output step that is waiting to be written.
+   */
+  struct OutputJob
+  {
+    unsigned int                                 buffer_index = 0;
+    std::vector<const dealii::DoFHandler<dim> *> dof_handlers;
+    unsigned int                                 degree    = 0;
+    unsigned int                                 increment = 0;
+    double                                       time      = 0.0;
+    std::string                                  name;
+  };
+
+  /**
+   * @brief Write the queued output until the object is destroyed.
+   */
+  void
+  process_jobs();
+
+  /**
+   * @brief Rethrow the exception of the worker thread, if any.
+   */
+  void
+  rethrow_worker_exception();
+
+  /**
+   * @brief User-inputs.
+   */
+  const UserInputParameters<dim> *user_inputs;
+
+  /**
+   * @brief The rank of this process.
+   */
+  unsigned int mpi_rank;
+
+  /**
+   * @brief The number of processes.
+   */
+  unsigned int n_mpi_processes;
+
+  /**
+   * @brief The pool of solution buffers.
+   */
+  std::vector<std::map<unsigned int, VectorType>> buffer_pool;
+
+  /**
+   * @brief The indices of the buffers that are free.
+   */
+  std::vector<unsigned int> free_buffers;
+
+  /**
+   * @brief The output steps waiting to be written.
+   */
+  std::deque<OutputJob> jobs;
+
+  /**
+   * @brief The exception thrown by the worker thread.
+   */
+  std::exception_ptr worker_exception;
+
+  /**
+   * @brief Whether the worker thread should stop.
+   */
+  bool finished = false;
+
+  /**
+   * @brief Mutex that guards the queue and the free buffers.
+   */
+  std::mutex mutex;
+
+  /**
+   * @brief Condition variable for changes to the queue and the free buffers.
+   */
+  std::condition_variable condition;
+
+  /**
+   * @brief The worker thread.
+   */
+  std::thread worker;
+};
+
+PRISMS_PF_END_NAMESPACE
@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#pragma once
+
+#include <prismspf/config.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+template <unsigned int dim>
+class UserInputParameters;
+
+template <unsigned int dim>
+class TriangulationHandler;
+
+template <unsigned int dim, typename number>
+class SolutionHandler;
+
+template <unsigned int dim, typename number>
+class MatrixFreeContainer;
+
+struct XDMFRecord;
+
+/**
+ * @brief Class that saves and loads checkpoints for restarting a simulation.
+ *
+ * A checkpoint is a directory that holds the triangulation, with all solution vectors
+ * (including the old solutions) attached to it, the time state, and the record of the
+ * HDF5 output steps, so the XDMF file still indexes them after a restart. Once a
+ * checkpoint is complete, its directory is recorded in a pointer file, so an interrupted
+ * save never replaces the last complete checkpoint.
+ *
+ * Checkpoints can be written to a directory on fast storage first. Every flush period
+ * checkpoints, the first process copies the checkpoint to the working directory on a
+ * background thread while the simulation continues. The same thread deletes the old
+ * checkpoints and logs the cost of each one to checkpoint.log. Only the checkpoints in
+ * the working directory are used for restarts.
+ */
+template <unsigned int dim, typename number>
+class CheckpointHandler
+{
+public:
+  /**
+   * @brief Constructor.
+   */
+  CheckpointHandler(const UserInputParameters<dim>   &_user_inputs,
+                    const TriangulationHandler<dim>  &_triangulation_handler,
+                    SolutionHandler<dim, number>     &_solution_handler,
+                    MatrixFreeContainer<dim, number> &_matrix_free_container,
+                    XDMFRecord                       &_xdmf_record);
+
+  /**
+   * @brief Destructor. This waits for the pending checkpoints to be staged.
+   */
+  ~CheckpointHandler();
+
+  CheckpointHandler(const CheckpointHandler &)            = delete;
+  CheckpointHandler &operator=(const CheckpointHandler &) = delete;
+  CheckpointHandler(CheckpointHandler &&)                 = delete;
+  CheckpointHandler &operator=(CheckpointHandler &&)      = delete;
+
+  /**
+   * @brief Save a checkpoint of the current increment. If force_flush is true, the
+   * checkpoint is copied to the working directory regardless of the flush period.
+   */
+  void
+  save(bool force_flush = false);
+
+  /**
+   * @brief Wait for the pending checkpoints to be staged to the working directory.
+   */
+  void
+  wait();
+
+  /**
+   * @brief Get the wall time, in seconds, of the latest checkpoint. This is the time to
+   * write it plus the time to stage it, or 0 if no checkpoint has been saved.
+   */
+  [[nodiscard]] double
+  get_checkpoint_cost();
+
+  /**
+   * @brief Get the triangulation file of the latest checkpoint. This is passed to the
+   * triangulation handler when the mesh is generated.
+   */
+  [[nodiscard]] std::string
+  get_triangulation_filename() const;
+
+  /**
+   * @brief Load the solutions, the time state, and the record of the HDF5 output steps of
+   * the latest checkpoint. The mesh must have been loaded from the checkpoint and the
+   * solution set initialized on it.
+   */
+  void
+  load();
+
+private:
+  /**
+   * @brief A checkpoint that is waiting to be staged.
+   */
+  struct StagingJob
+  {
+    unsigned int increment     = 0;
+    std::string  name;
+    bool         flush         = true;
+    double       write_seconds = 0.0;
+  };
+
+  /**
+   * @brief Get the directory of the latest checkpoint from the pointer file.
+   */
+  [[nodiscard]] std::string
+  get_latest_directory() const;
+
+  /**
+   * @brief Stage the queued checkpoints until the object is destroyed.
+   */
+  void
+  process_jobs();
+
+  /**
+   * @brief Copy a checkpoint to the working directory, if needed, record it as the
+   * latest, delete the old checkpoints, and log its cost.
+   */
+  void
+  stage(const StagingJob &job);
+
+  /**
+   * @brief Delete the oldest checkpoints in a directory that are not newer than the
+   * given increment, so that only the most recent ones are kept.
+   */
+  void
+  delete_old_checkpoints(const std::string &parent, unsigned int max_increment) const;
+
+  /**
+   * @brief Rethrow the exception of the worker thread, if any.
+   */
+  void
+  rethrow_worker_exception();
+
+  /**
+   * @brief User-inputs.
+   */
+  const UserInputParameters<dim> *user_inputs;
+
+  /**
+   * @brief Triangulation handler.
+   */
+  const TriangulationHandler<dim> *triangulation_handler;
+
+  /**
+   * @brief Solution handler.
+   */
+  SolutionHandler<dim, number> *solution_handler;
+
+  /**
+   * @brief Matrix-free object container.
+   */
+  MatrixFreeContainer<dim, number> *matrix_free_container;
+
+  /**
+   * @brief Record of the HDF5 output steps.
+   */
+  XDMFRecord *xdmf_record;
+
+  /**
+   * @brief The number of checkpoints saved in this run.
+   */
+  unsigned int n_saved = 0;
+
+  /**
+   * @brief The time to write the latest checkpoint.
+   */
+  double last_write_seconds = 0.0;
+
+  /**
+   * @brief The time to stage the latest staged checkpoint. This is only set on the first
+   * process.
+   */
+  double last_stage_seconds = 0.0;
+
+  /**
+   * @brief The checkpoints waiting to be staged.
+   */
+  std::deque<StagingJob> jobs;
+
+  /**
+   * @brief Whether a job is being staged.
+   */
+  bool staging = false;
+
+  /**
+   * @brief The exception thrown by the worker thread.
+   */
+  std::exception_ptr worker_exception;
+
+  /**
+   * @brief Whether the worker thread should stop.
+   */
+  bool finished = false;
+
+  /**
+   * @brief Mutex that guards the queue and the staging time.
+   */
+  std::mutex mutex;
+
+  /**
+   * @brief Condition variable for changes to the queue.
+   */
+  std::condition_variable condition;
+
+  /**
+   * @brief The worker thread. This only runs on the first process and is started by the
+   * first save.
+   */
+  std::thread worker;
+};
+
+PRISMS_PF_END_NAMESPACE
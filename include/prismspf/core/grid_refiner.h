@@ -3,51 +3,50 @@
 
 #pragma once
 
-#include <deal.II/fe/fe_values.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/fe/component_mask.h>
+#include <deal.II/grid/cell_id.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+#include <deal.II/matrix_free/evaluation_flags.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/derivative_approximation.h>
+#include <deal.II/numerics/error_estimator.h>
 
 #include <prismspf/core/grid_refiner_context.h>
 
 #include <prismspf/config.h>
 
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
 PRISMS_PF_BEGIN_NAMESPACE
 
 template <unsigned int dim, unsigned int degree, typename number>
 class GridRefiner
 {
 public:
+  using VectorType   = dealii::LinearAlgebra::distributed::Vector<number>;
+  using SizeType     = dealii::VectorizedArray<number>;
+  using CellIterator = typename TriangulationHandler<dim>::CellIterator;
+
   /**
    * @brief Constructor.
    */
   explicit GridRefiner(
     GridRefinementContext<dim, degree, number> &grid_refinement_context)
-    : grid_refinement_context(grid_refinement_context)
-  {
-    fe_values_flags.resize(static_cast<Types::Index>(FieldType::Vector) + 1,
-                           dealii::UpdateFlags::update_default);
-
-    for (const auto &criterion : grid_refinement_context.get_user_inputs()
-                                   .get_spatial_discretization()
-                                   .get_refinement_criteria())
-      {
-        // Grab the index and field type
-        const Types::Index index            = criterion.get_index();
-        const FieldType    local_field_type = grid_refinement_context.get_user_inputs()
-                                             .get_variable_attributes()
-                                             .at(index)
-                                             .get_field_type();
-
-        if (criterion.get_criterion() & GridRefinement::RefinementFlags::Value)
-          {
-            fe_values_flags[static_cast<Types::Index>(local_field_type)] |=
-              dealii::UpdateFlags::update_values;
-          }
-        else if (criterion.get_criterion() & GridRefinement::RefinementFlags::Gradient)
-          {
-            fe_values_flags[static_cast<Types::Index>(local_field_type)] |=
-              dealii::UpdateFlags::update_gradients;
-          }
-      }
-  };
+    : grid_refinement_context(grid_refinement_context) {};
 
   /**
    * @brief Destructor.
@@ -88,7 +87,7 @@ public:
    * @brief Initialize the object.
    */
   void
-  init(const std::map<FieldType, dealii::FESystem<dim>> &fe_system)
+  init()
   {
     // Return early if adaptive meshing is disabled
     if (!grid_refinement_context.get_user_inputs()
@@ -100,30 +99,19 @@ public:
         return;
       }
 
-    // Set quadrature rule
-    const dealii::QGaussLobatto<dim> quadrature(degree + 1);
+    // Get the number of quadrature points. The criteria are evaluated at the same
+    // Gauss-Lobatto points as the matrix-free operators.
+    num_quad_points = dealii::Utilities::pow(degree + 1, dim);
 
-    for (const auto &[field_type, system] : fe_system)
+    // Measure the cost of each cell batch for the cell weights
+    if (grid_refinement_context.get_user_inputs()
+          .get_spatial_discretization()
+          .get_cell_weighting() == GridRefinement::Measured)
       {
-        const unsigned int spacedim = field_type == FieldType::Scalar ? 1 : dim;
-
-        // Recreate the FESystem for the field type. I hate to do this, but we have to
-        // ensure that this proper lifetime management and FESystem has it's copy
-        // constructor deleted.
-        fe_systems.try_emplace(field_type,
-                               dealii::FE_Q<dim>(dealii::QGaussLobatto<1>(degree + 1)),
-                               spacedim);
-
-        // Create the FEValues using the stored FESystem
-        fe_values.try_emplace(field_type,
-                              fe_systems.at(field_type),
-                              quadrature,
-                              fe_values_flags[static_cast<Types::Index>(field_type)]);
+        grid_refinement_context.get_element_volume_container()
+          .set_record_cell_batch_cost(true);
       }
 
-    // Get the number of quadrature points
-    num_quad_points = quadrature.size();
-
     // Get the min and max global refinements
     max_refinement = grid_refinement_context.get_user_inputs()
                        .get_spatial_discretization()
@@ -143,8 +131,14 @@ public:
    * 4. Transfer the solution from old to new
    * 5. Recompute and reapply the constraints (this is done in the solvers)
    * 6. Recompute invm & element volume (if applicable)
+   * 7. Repartition the grid if the cells are weighted and the load imbalance is too
+   * large. This repeats steps 3-6.
+   *
+   * If no cell on any process is flagged after step 1, steps 2-6 are skipped.
+   *
+   * @return Whether the grid changed, in which case the solvers must be reinitialized.
    */
-  void
+  bool
   do_adaptive_refinement()
   {
     // Return early if adaptive meshing is disabled
@@ -152,7 +146,7 @@ public:
            .get_spatial_discretization()
            .get_has_adaptivity())
       {
-        return;
+        return false;
       }
 
     Assert(num_quad_points != 0,
@@ -162,10 +156,612 @@ public:
     // Step 1
     mark_cells_for_refinement_and_coarsening();
 
+    // Keep the measured cost of the cells before they change
+    store_measured_cell_cost();
+
     // Step 2
-    refine_grid();
+    const bool refined = refine_grid();
+
+    // Step 3-6
+    if (refined)
+      {
+        reinit_after_grid_change();
+      }
+
+    // Step 7
+    const bool repartitioned = balance_load();
+
+    return refined || repartitioned;
+  };
+
+  /**
+   * @brief Whether the refinement criteria are met on any cell next to the refined
+   * region, on any process. This means that the features tracked by the criteria are
+   * leaving the refined region and the grid should be refined.
+   *
+   * The cells next to the refined region are those below the maximum refinement level
+   * that share a face with a finer cell at the maximum level. Since the tracked features
+   * move continuously, they cross these cells before they reach the rest of the grid.
+   * Only the cell batches that contain such cells are evaluated, so the cost scales with
+   * the boundary of the refined region rather than with the whole grid. Features that
+   * appear away from the refined region, like new nuclei, are picked up by the periodic
+   * remeshing instead.
+   */
+  [[nodiscard]] bool
+  criteria_met_outside_refined_region()
+  {
+    if (!grid_refinement_context.get_user_inputs()
+           .get_spatial_discretization()
+           .get_has_adaptivity())
+      {
+        return false;
+      }
+
+    const auto &matrix_free =
+      *grid_refinement_context.get_matrix_free_container().get_matrix_free();
+
+    // Flag the lanes of the cells that are not next to the refined region so they are
+    // skipped
+    if (skipped_lanes.size() != matrix_free.n_cell_batches() * SizeType::size())
+      {
+        find_lanes_next_to_refined_region();
+      }
+
+    bool criteria_met = false;
+    if (n_lanes_next_to_refined_region > 0)
+      {
+        dealii::Vector<number> should_refine(skipped_lanes);
+        evaluate_threshold_criteria(should_refine);
+
+        for (unsigned int i = 0; i < should_refine.size(); ++i)
+          {
+            if (should_refine[i] != 0.0 && skipped_lanes[i] == 0.0)
+              {
+                criteria_met = true;
+                break;
+              }
+          }
+      }
+
+    return dealii::Utilities::MPI::logical_or(criteria_met, MPI_COMM_WORLD);
+  }
+
+private:
+  /**
+   * @brief Mark cells for refinement and coarsening
+   */
+  void
+  mark_cells_for_refinement_and_coarsening()
+  {
+    if (grid_refinement_context.get_user_inputs()
+          .get_spatial_discretization()
+          .get_marking_strategy() == GridRefinement::Threshold)
+      {
+        mark_cells_by_threshold();
+      }
+    else
+      {
+        mark_cells_by_error_indicator();
+      }
+
+    add_refinement_buffer_layers();
+  }
+
+  /**
+   * @brief Mark cells for refinement and coarsening according to the value and gradient
+   * thresholds.
+   *
+   * The refinement criteria are evaluated on the cell batches of the matrix-free object,
+   * so each evaluation covers a full SIMD batch of cells and the cell ranges are
+   * distributed over the threads by cell_loop(). The resulting flags are then scattered
+   * back to the cells of the triangulation.
+   */
+  void
+  mark_cells_by_threshold()
+  {
+    const auto &matrix_free =
+      *grid_refinement_context.get_matrix_free_container().get_matrix_free();
+
+    // Whether each lane of each cell batch should be refined
+    dealii::Vector<number> should_refine(matrix_free.n_cell_batches() * SizeType::size());
+    evaluate_threshold_criteria(should_refine);
+
+    // Clear user flags
+    grid_refinement_context.get_triangulation_handler().clear_user_flags();
+
+    // Scatter the flags back to the cells
+    for (unsigned int batch = 0; batch < matrix_free.n_cell_batches(); ++batch)
+      {
+        for (unsigned int lane = 0;
+             lane < matrix_free.n_active_entries_per_cell_batch(batch);
+             ++lane)
+          {
+            const auto cell = matrix_free.get_cell_iterator(batch, lane);
+
+            const bool refine_cell =
+              should_refine[(batch * SizeType::size()) + lane] != 0.0;
+
+            Assert(cell->level() > 0,
+                   dealii::ExcMessage("Cell refinement level is less than one, which "
+                                      "will lead to underflow."));
+            const auto cell_refinement = static_cast<unsigned int>(cell->level());
+            if (refine_cell && cell_refinement < max_refinement)
+              {
+                cell->set_user_flag();
+                cell->clear_coarsen_flag();
+                cell->set_refine_flag();
+              }
+            if (refine_cell)
+              {
+                cell->set_user_flag();
+                cell->clear_coarsen_flag();
+              }
+            if (!refine_cell && cell_refinement > min_refinement &&
+                !cell->user_flag_set())
+              {
+                cell->set_coarsen_flag();
+              }
+          }
+      }
+  }
+
+  /**
+   * @brief Evaluate the value and gradient criteria on the cell batches and flag the
+   * lanes that meet them. Lanes that are already flagged are kept and batches where every
+   * lane is flagged are skipped.
+   */
+  void
+  evaluate_threshold_criteria(dealii::Vector<number> &should_refine) const
+  {
+    const auto &matrix_free =
+      *grid_refinement_context.get_matrix_free_container().get_matrix_free();
+
+    for (const auto &criterion : grid_refinement_context.get_user_inputs()
+                                   .get_spatial_discretization()
+                                   .get_refinement_criteria())
+      {
+        // Grab the index
+        const Types::Index index = criterion.get_index();
+
+        // Grab the field type
+        const FieldType local_field_type = grid_refinement_context.get_user_inputs()
+                                             .get_variable_attributes()
+                                             .at(index)
+                                             .get_field_type();
+
+        const auto local_mark =
+          [&](const dealii::MatrixFree<dim, number, SizeType> &data,
+              dealii::Vector<number>                           &dst,
+              const VectorType                                 &src,
+              const std::pair<unsigned int, unsigned int>      &cell_range)
+        {
+          if (local_field_type == FieldType::Scalar)
+            {
+              mark_cell_batches<1>(data, criterion, dst, src, cell_range);
+            }
+          else
+            {
+              mark_cell_batches<dim>(data, criterion, dst, src, cell_range);
+            }
+        };
+
+        matrix_free.template cell_loop<dealii::Vector<number>, VectorType>(
+          local_mark,
+          should_refine,
+          *grid_refinement_context.get_solution_handler().get_solution_vector(
+            index,
+            DependencyType::Normal));
+      }
+  }
+
+  /**
+   * @brief Flag the lanes of the cell batches whose cells are not next to the refined
+   * region in skipped_lanes, and count the others.
+   */
+  void
+  find_lanes_next_to_refined_region()
+  {
+    const auto &matrix_free =
+      *grid_refinement_context.get_matrix_free_container().get_matrix_free();
+
+    skipped_lanes.reinit(matrix_free.n_cell_batches() * SizeType::size());
+    skipped_lanes                  = 1.0;
+    n_lanes_next_to_refined_region = 0;
+    for (unsigned int batch = 0; batch < matrix_free.n_cell_batches(); ++batch)
+      {
+        for (unsigned int lane = 0;
+             lane < matrix_free.n_active_entries_per_cell_batch(batch);
+             ++lane)
+          {
+            const auto cell  = matrix_free.get_cell_iterator(batch, lane);
+            const auto level = static_cast<unsigned int>(cell->level());
+            if (level >= max_refinement)
+              {
+                continue;
+              }
+
+            // With the level difference limited to one, a neighbor is at the maximum
+            // level if it is, or if it is refined and the cell is one level below it
+            for (const unsigned int face : cell->face_indices())
+              {
+                const bool periodic = cell->has_periodic_neighbor(face);
+                if (cell->at_boundary(face) && !periodic)
+                  {
+                    continue;
+                  }
+                const auto neighbor =
+                  periodic ? cell->periodic_neighbor(face) : cell->neighbor(face);
+                const unsigned int neighbor_level =
+                  neighbor->has_children() ? level + 1
+                                           : static_cast<unsigned int>(neighbor->level());
+                if (neighbor_level >= max_refinement)
+                  {
+                    skipped_lanes[(batch * SizeType::size()) + lane] = 0.0;
+                    n_lanes_next_to_refined_region++;
+                    break;
+                  }
+              }
+          }
+      }
+  }
+
+  /**
+   * @brief Mark cells for refinement and coarsening according to the error indicators.
+   *
+   * The indicators of each criterion are normalized by their global maximum and summed,
+   * so that fields of different magnitude contribute equally. The cells are then marked
+   * with the fixed fraction or fixed number strategy and the flags are limited to the
+   * minimum and maximum refinement levels.
+   */
+  void
+  mark_cells_by_error_indicator()
+  {
+    const auto &spatial_discretization =
+      grid_refinement_context.get_user_inputs().get_spatial_discretization();
+    const auto &triangulation =
+      grid_refinement_context.get_triangulation_handler().get_triangulation();
+
+    dealii::Vector<float> estimated_error(triangulation.n_active_cells());
+    dealii::Vector<float> indicator(triangulation.n_active_cells());
+
+    // Clear user flags
+    grid_refinement_context.get_triangulation_handler().clear_user_flags();
+
+    for (const auto &criterion : spatial_discretization.get_refinement_criteria())
+      {
+        // Grab the index
+        const Types::Index index = criterion.get_index();
+
+        const auto &dof_handler =
+          grid_refinement_context.get_dof_handler().get_dof_handler(index);
+        const auto &solution =
+          *grid_refinement_context.get_solution_handler().get_solution_vector(
+            index,
+            DependencyType::Normal);
+
+        indicator = 0.0;
+        if ((criterion.get_criterion() & GridRefinement::RefinementFlags::Kelly) != 0U)
+          {
+            const std::map<dealii::types::boundary_id,
+                           const dealii::Function<dim, number> *>
+              neumann_boundary;
+            dealii::KellyErrorEstimator<dim>::estimate(
+              grid_refinement_context.get_mapping(),
+              dof_handler,
+              dealii::QGauss<dim - 1>(degree + 1),
+              neumann_boundary,
+              solution,
+              indicator,
+              dealii::ComponentMask(),
+              nullptr,
+              dealii::numbers::invalid_unsigned_int,
+              triangulation.locally_owned_subdomain());
+          }
+        else
+          {
+            compute_curvature_indicator(dof_handler, solution, indicator);
+          }
+
+        // Normalize the indicator and add it to the estimated error
+        const float max_indicator =
+          dealii::Utilities::MPI::max(indicator.linfty_norm(), MPI_COMM_WORLD);
+        if (max_indicator > 0.0F)
+          {
+            estimated_error.add(1.0F / max_indicator, indicator);
+          }
+      }
+
+    if (spatial_discretization.get_marking_strategy() == GridRefinement::FixedFraction)
+      {
+        grid_refinement_context.get_triangulation_handler()
+          .refine_and_coarsen_fixed_fraction(
+            estimated_error,
+            spatial_discretization.get_refine_fraction(),
+            spatial_discretization.get_coarsen_fraction());
+      }
+    else
+      {
+        grid_refinement_context.get_triangulation_handler()
+          .refine_and_coarsen_fixed_number(
+            estimated_error,
+            spatial_discretization.get_refine_fraction(),
+            spatial_discretization.get_coarsen_fraction(),
+            spatial_discretization.get_max_number_of_cells());
+      }
+
+    // Limit the flags to the minimum and maximum refinement levels
+    for (const auto &cell : triangulation.active_cell_iterators())
+      {
+        if (!cell->is_locally_owned())
+          {
+            continue;
+          }
+        const auto cell_refinement = static_cast<unsigned int>(cell->level());
+        if (cell->refine_flag_set())
+          {
+            cell->set_user_flag();
+          }
+        if (cell_refinement >= max_refinement)
+          {
+            cell->clear_refine_flag();
+          }
+        if (cell_refinement <= min_refinement)
+          {
+            cell->clear_coarsen_flag();
+          }
+      }
+  }
+
+  /**
+   * @brief Extend the refinement flags a number of neighbor layers outward from the cells
+   * that meet the refinement criteria, so moving features stay inside the refined region
+   * for more steps. The cells that meet the criteria are the ones with the user flag set.
+   *
+   * Each layer adds the locally owned cells that share a face, including periodic faces,
+   * with a cell of the previous layer. The flags of the ghost cells are exchanged before
+   * each layer so the layers are continuous across processes.
+   */
+  void
+  add_refinement_buffer_layers()
+  {
+    const unsigned int n_buffer_layers = grid_refinement_context.get_user_inputs()
+                                           .get_spatial_discretization()
+                                           .get_refinement_buffer_layers();
+    if (n_buffer_layers == 0)
+      {
+        return;
+      }
+
+    using Triangulation = typename TriangulationHandler<dim>::Triangulation;
+    using ActiveCellIterator = typename Triangulation::active_cell_iterator;
+
+    const auto &triangulation =
+      grid_refinement_context.get_triangulation_handler().get_triangulation();
+
+    // Whether each active cell is in the buffered region
+    std::vector<bool> in_region(triangulation.n_active_cells(), false);
+    for (const auto &cell : triangulation.active_cell_iterators())
+      {
+        if (cell->is_locally_owned() && cell->user_flag_set())
+          {
+            in_region[cell->active_cell_index()] = true;
+          }
+      }
+
+    const auto in_region_on_face = [&](const ActiveCellIterator &cell, unsigned int face)
+    {
+      const bool periodic = cell->has_periodic_neighbor(face);
+      if (cell->at_boundary(face) && !periodic)
+        {
+          return false;
+        }
+      const auto neighbor =
+        periodic ? cell->periodic_neighbor(face) : cell->neighbor(face);
+      if (neighbor->is_active())
+        {
+          return static_cast<bool>(in_region[neighbor->active_cell_index()]);
+        }
+      for (unsigned int subface = 0; subface < cell->face(face)->n_children(); ++subface)
+        {
+          const auto child = periodic
+                               ? cell->periodic_neighbor_child_on_subface(face, subface)
+                               : cell->neighbor_child_on_subface(face, subface);
+          if (in_region[child->active_cell_index()])
+            {
+              return true;
+            }
+        }
+      return false;
+    };
 
-    // Step 3
+    std::vector<unsigned int> new_layer;
+    for (unsigned int layer = 0; layer < n_buffer_layers; ++layer)
+      {
+        dealii::GridTools::exchange_cell_data_to_ghosts<bool, Triangulation>(
+          triangulation,
+          [&](const ActiveCellIterator &cell) -> std::optional<bool>
+          {
+            return static_cast<bool>(in_region[cell->active_cell_index()]);
+          },
+          [&](const ActiveCellIterator &cell, const bool &value)
+          {
+            in_region[cell->active_cell_index()] = value;
+          });
+
+        new_layer.clear();
+        for (const auto &cell : triangulation.active_cell_iterators())
+          {
+            if (!cell->is_locally_owned() || in_region[cell->active_cell_index()])
+              {
+                continue;
+              }
+            for (const unsigned int face : cell->face_indices())
+              {
+                if (in_region_on_face(cell, face))
+                  {
+                    new_layer.push_back(cell->active_cell_index());
+                    break;
+                  }
+              }
+          }
+        for (const unsigned int index : new_layer)
+          {
+            in_region[index] = true;
+          }
+      }
+
+    // Refine the buffered region up to the maximum refinement level
+    for (const auto &cell : triangulation.active_cell_iterators())
+      {
+        if (!cell->is_locally_owned() || !in_region[cell->active_cell_index()])
+          {
+            continue;
+          }
+        cell->set_user_flag();
+        cell->clear_coarsen_flag();
+        if (static_cast<unsigned int>(cell->level()) < max_refinement)
+          {
+            cell->set_refine_flag();
+          }
+      }
+  }
+
+  /**
+   * @brief Compute the curvature indicator of a field. This is the norm of the
+   * approximate second derivative, summed over the components, and scaled by
+   * h^{2 + dim / 2} so it estimates the L2 interpolation error on each cell.
+   */
+  void
+  compute_curvature_indicator(const dealii::DoFHandler<dim> &dof_handler,
+                              const VectorType              &solution,
+                              dealii::Vector<float>         &indicator) const
+  {
+    dealii::Vector<float> component_indicator(indicator.size());
+    for (unsigned int component = 0; component < dof_handler.get_fe().n_components();
+         ++component)
+      {
+        dealii::DerivativeApproximation::approximate_second_derivative(
+          grid_refinement_context.get_mapping(),
+          dof_handler,
+          solution,
+          component_indicator,
+          component);
+        for (unsigned int i = 0; i < indicator.size(); ++i)
+          {
+            indicator[i] += component_indicator[i] * component_indicator[i];
+          }
+      }
+
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      {
+        if (!cell->is_locally_owned())
+          {
+            continue;
+          }
+        const unsigned int cell_index = cell->active_cell_index();
+        indicator[cell_index] =
+          static_cast<float>(std::sqrt(indicator[cell_index]) *
+                             std::pow(cell->diameter(), 2.0 + (dim / 2.0)));
+      }
+  }
+
+  /**
+   * @brief Evaluate a refinement criterion on a range of cell batches and flag the lanes
+   * that should be refined.
+   */
+  template <unsigned int n_components>
+  void
+  mark_cell_batches(
+    const dealii::MatrixFree<dim, number, SizeType> &data,
+    const GridRefinement::RefinementCriterion       &criterion,
+    dealii::Vector<number>                          &should_refine,
+    const VectorType                                &solution,
+    const std::pair<unsigned int, unsigned int>     &cell_range) const
+  {
+    const bool check_value =
+      (criterion.get_criterion() & GridRefinement::RefinementFlags::Value) != 0U;
+    const bool check_gradient =
+      (criterion.get_criterion() & GridRefinement::RefinementFlags::Gradient) != 0U;
+
+    dealii::EvaluationFlags::EvaluationFlags flags = dealii::EvaluationFlags::nothing;
+    if (check_value)
+      {
+        flags |= dealii::EvaluationFlags::values;
+      }
+    if (check_gradient)
+      {
+        flags |= dealii::EvaluationFlags::gradients;
+      }
+
+    dealii::FEEvaluation<dim, degree, degree + 1, n_components, number> fe_eval(
+      data,
+      criterion.get_index());
+
+    constexpr unsigned int n_lanes = SizeType::size();
+
+    for (unsigned int batch = cell_range.first; batch < cell_range.second; ++batch)
+      {
+        const unsigned int n_active_lanes = data.n_active_entries_per_cell_batch(batch);
+
+        // Skip the batch if all of its cells are already flagged by another criterion
+        bool all_flagged = true;
+        for (unsigned int lane = 0; lane < n_active_lanes; ++lane)
+          {
+            all_flagged = all_flagged && should_refine[(batch * n_lanes) + lane] != 0.0;
+          }
+        if (all_flagged)
+          {
+            continue;
+          }
+
+        fe_eval.reinit(batch);
+        fe_eval.read_dof_values_plain(solution);
+        fe_eval.evaluate(flags);
+
+        for (const unsigned int q_point : fe_eval.quadrature_point_indices())
+          {
+            // Either the value for scalar fields or the magnitude for vector fields, and
+            // the magnitude of the gradient.
+            SizeType value(0.0);
+            SizeType gradient_magnitude(0.0);
+            if (check_value)
+              {
+                if constexpr (n_components == 1)
+                  {
+                    value = fe_eval.get_value(q_point);
+                  }
+                else
+                  {
+                    value = fe_eval.get_value(q_point).norm();
+                  }
+              }
+            if (check_gradient)
+              {
+                gradient_magnitude = fe_eval.get_gradient(q_point).norm();
+              }
+
+            for (unsigned int lane = 0; lane < n_active_lanes; ++lane)
+              {
+                if ((check_value && criterion.value_in_open_range(value[lane])) ||
+                    (check_gradient &&
+                     criterion.gradient_magnitude_above_threshold(
+                       gradient_magnitude[lane])))
+                  {
+                    should_refine[(batch * n_lanes) + lane] = 1.0;
+                  }
+              }
+          }
+      }
+  }
+
+  /**
+   * @brief Redistribute the DoFs, recompute the constraints and matrix-free objects,
+   * transfer the solutions, and recompute the invm and element volumes after the grid
+   * has changed.
+   */
+  void
+  reinit_after_grid_change()
+  {
     grid_refinement_context.get_triangulation_handler().reinit();
     grid_refinement_context.get_dof_handler().reinit(
       grid_refinement_context.get_triangulation_handler(),
@@ -202,216 +798,250 @@ public:
     grid_refinement_context.get_solution_handler().reinit(
       grid_refinement_context.get_matrix_free_container());
 
-    // Step 4
+    // Transfer the solutions
     grid_refinement_context.get_solution_handler().execute_solution_transfer();
     grid_refinement_context.get_solution_handler().free_solution_transfer();
     grid_refinement_context.get_solution_handler().reinit_solution_transfer(
       grid_refinement_context.get_matrix_free_container());
 
-    // Step 6
+    // Recompute invm and element volumes
     grid_refinement_context.get_invm_handler().recompute_invm();
     grid_refinement_context.get_element_volume_container().recompute_element_volume();
 
+    // The cell batches have changed
+    skipped_lanes.reinit(0);
+
     // Update the ghosts
     grid_refinement_context.get_solution_handler().update_ghosts();
-  };
+  }
 
-private:
   /**
-   * @brief Mark cells for refinement and coarsening
+   * @brief Store the measured cost of each locally owned cell, so that it can be mapped
+   * onto the refined grid.
    */
   void
-  mark_cells_for_refinement_and_coarsening()
+  store_measured_cell_cost()
   {
-    // Create the an object for the refinement criterion at each of the quad points. This
-    // will either contain the value for scalar fields, the magnitude for vector fields,
-    // or the magnitude of the gradient for both of the fields.
-    std::vector<number> values(num_quad_points, 0.0);
+    if (grid_refinement_context.get_user_inputs()
+          .get_spatial_discretization()
+          .get_cell_weighting() != GridRefinement::Measured)
+      {
+        return;
+      }
 
-    // Clear user flags
-    grid_refinement_context.get_triangulation_handler().clear_user_flags();
+    measured_cell_cost.clear();
+    measured_parent_cost.clear();
 
-    // Loop over the cells provided by the triangulation
-    for (const auto &cell : grid_refinement_context.get_triangulation_handler()
-                              .get_triangulation()
-                              .active_cell_iterators())
+    const auto &matrix_free =
+      *grid_refinement_context.get_matrix_free_container().get_matrix_free();
+    const auto &cell_batch_cost = grid_refinement_context.get_element_volume_container()
+                                    .get_element_volume()
+                                    .get_cell_batch_cost();
+
+    for (unsigned int batch = 0; batch < cell_batch_cost.size(); ++batch)
       {
-        if (cell->is_locally_owned())
+        const unsigned int n_lanes = matrix_free.n_active_entries_per_cell_batch(batch);
+        for (unsigned int lane = 0; lane < n_lanes; ++lane)
           {
-            // Whether we should refine the cell
-            bool should_refine = false;
+            const auto   cell = matrix_free.get_cell_iterator(batch, lane);
+            const double cost = cell_batch_cost[batch] / n_lanes;
 
-            // TODO (landinjm): We can probably avoid checking some of the neighboring
-            // cells when coarsening them
-            for (const auto &criterion : grid_refinement_context.get_user_inputs()
-                                           .get_spatial_discretization()
-                                           .get_refinement_criteria())
+            measured_cell_cost[cell->id()] = cost;
+            if (cell->level() > 0)
               {
-                // Grab the index
-                const Types::Index index = criterion.get_index();
-
-                // Grab the field type
-                const FieldType local_field_type =
-                  grid_refinement_context.get_user_inputs()
-                    .get_variable_attributes()
-                    .at(index)
-                    .get_field_type();
-
-                // Grab the DoFHandler iterator
-                const auto dof_iterator = cell->as_dof_handler_iterator(
-                  grid_refinement_context.get_dof_handler().get_dof_handler(index));
+                measured_parent_cost[cell->parent()->id()] += cost;
+              }
+          }
+      }
+  }
 
-                // Reinit the cell
-                fe_values.at(local_field_type).reinit(dof_iterator);
+  /**
+   * @brief Compute the relative cost of a cell, either from the user or from the measured
+   * cost of the cell (or its parent or children) before the last refinement.
+   */
+  [[nodiscard]] double
+  compute_cell_cost(const CellIterator &cell) const
+  {
+    if (grid_refinement_context.get_user_inputs()
+          .get_spatial_discretization()
+          .get_cell_weighting() == GridRefinement::User)
+      {
+        // Compute the average value of each field on the cell
+        std::map<Types::Index, number> cell_average;
+        for (const auto &[index, variable] :
+             grid_refinement_context.get_user_inputs().get_variable_attributes())
+          {
+            const auto dof_cell = cell->as_dof_handler_iterator(
+              grid_refinement_context.get_dof_handler().get_dof_handler(index));
+            const auto &fe = dof_cell->get_fe();
 
-                if (criterion.get_criterion() & GridRefinement::RefinementFlags::Value)
-                  {
-                    if (local_field_type == FieldType::Scalar)
-                      {
-                        // Get the values for a scalar field
-                        fe_values.at(local_field_type)
-                          .get_function_values(
-                            *grid_refinement_context.get_solution_handler()
-                               .get_solution_vector(index, DependencyType::Normal),
-                            values);
-                      }
-                    else
-                      {
-                        // Get the magnitude of the value for vector fields
-                        // TODO (landinjm): Should be zeroing this out?
-                        std::vector<dealii::Vector<number>> vector_values(
-                          num_quad_points,
-                          dealii::Vector<number>(dim));
-                        fe_values.at(local_field_type)
-                          .get_function_values(
-                            *grid_refinement_context.get_solution_handler()
-                               .get_solution_vector(index, DependencyType::Normal),
-                            vector_values);
-                        for (unsigned int q_point = 0; q_point < num_quad_points;
-                             ++q_point)
-                          {
-                            values[q_point] = vector_values[q_point].l2_norm();
-                          }
-                      }
-
-                    // Check if any of the quadrature points meet the refinement criterion
-                    for (unsigned int q_point = 0; q_point < num_quad_points; ++q_point)
-                      {
-                        if (criterion.value_in_open_range(values[q_point]))
-                          {
-                            should_refine = true;
-                            break;
-                          }
-                      }
-
-                    // Exit if we've already determined that the cell has to be refined
-                    if (should_refine)
-                      {
-                        break;
-                      }
-                  }
-                if (criterion.get_criterion() & GridRefinement::RefinementFlags::Gradient)
-                  {
-                    if (local_field_type == FieldType::Scalar)
-                      {
-                        // Get the magnitude of the gradient for a scalar field
-                        // TODO (landinjm): Should be zeroing this out?
-                        std::vector<dealii::Tensor<1, dim, number>> scalar_gradients(
-                          num_quad_points);
-                        fe_values.at(local_field_type)
-                          .get_function_gradients(
-                            *grid_refinement_context.get_solution_handler()
-                               .get_solution_vector(index, DependencyType::Normal),
-                            scalar_gradients);
-                        for (unsigned int q_point = 0; q_point < num_quad_points;
-                             ++q_point)
-                          {
-                            values[q_point] = scalar_gradients[q_point].norm();
-                          }
-                      }
-                    else
-                      {
-                        // TODO (landinjm): Should be zeroing this out?
-                        std::vector<std::vector<dealii::Tensor<1, dim, number>>>
-                          vector_gradients(num_quad_points,
-                                           std::vector<dealii::Tensor<1, dim, number>>(
-                                             dim));
-                        fe_values.at(local_field_type)
-                          .get_function_gradients(
-                            *grid_refinement_context.get_solution_handler()
-                               .get_solution_vector(index, DependencyType::Normal),
-                            vector_gradients);
-                        for (unsigned int q_point = 0; q_point < num_quad_points;
-                             ++q_point)
-                          {
-                            dealii::Vector<number> vector_gradient_component_magnitude(
-                              dim);
-                            for (unsigned int dimension = 0; dimension < dim; dimension++)
-                              {
-                                vector_gradient_component_magnitude[dimension] =
-                                  vector_gradients[q_point][dimension].norm();
-                              }
-                            values[q_point] =
-                              vector_gradient_component_magnitude.l2_norm();
-                          }
-                      }
-
-                    // Check if any of the quadrature points meet the refinement criterion
-                    for (unsigned int q_point = 0; q_point < num_quad_points; ++q_point)
-                      {
-                        if (criterion.gradient_magnitude_above_threshold(values[q_point]))
-                          {
-                            should_refine = true;
-                            break;
-                          }
-                      }
-
-                    // Exit if we've already determined that the cell has to be refined
-                    if (should_refine)
-                      {
-                        break;
-                      }
-                  }
-              }
+            dealii::Vector<number> local_values(fe.n_dofs_per_cell());
+            dof_cell->get_dof_values(
+              *grid_refinement_context.get_solution_handler().get_solution_vector(
+                index,
+                DependencyType::Normal),
+              local_values);
 
-            Assert(cell->level() > 0,
-                   dealii::ExcMessage("Cell refinement level is less than one, which "
-                                      "will lead to underflow."));
-            const auto cell_refinement = static_cast<unsigned int>(cell->level());
-            if (should_refine && cell_refinement < max_refinement)
-              {
-                cell->set_user_flag();
-                cell->clear_coarsen_flag();
-                cell->set_refine_flag();
-              }
-            if (should_refine)
+            std::vector<number> component_average(fe.n_components(), 0.0);
+            for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
               {
-                cell->set_user_flag();
-                cell->clear_coarsen_flag();
+                component_average[fe.system_to_component_index(i).first] +=
+                  local_values[i] * fe.n_components() / fe.n_dofs_per_cell();
               }
-            if (!should_refine && cell_refinement > min_refinement &&
-                !cell->user_flag_set())
+
+            number magnitude = 0.0;
+            for (const number &average : component_average)
               {
-                cell->set_coarsen_flag();
+                magnitude += average * average;
               }
+            cell_average[index] = variable.get_field_type() == FieldType::Scalar
+                                    ? component_average[0]
+                                    : std::sqrt(magnitude);
+          }
+
+        return static_cast<double>(
+          grid_refinement_context.get_pde_operator().compute_cell_weight(cell->center(),
+                                                                          cell_average));
+      }
+
+    // The cell persisted
+    if (const auto iterator = measured_cell_cost.find(cell->id());
+        iterator != measured_cell_cost.end())
+      {
+        return iterator->second;
+      }
+
+    // The cell was refined, so split the cost of the parent over the children
+    if (cell->level() > 0)
+      {
+        if (const auto iterator = measured_cell_cost.find(cell->parent()->id());
+            iterator != measured_cell_cost.end())
+          {
+            return iterator->second / cell->parent()->n_children();
+          }
+      }
+
+    // The children were coarsened, so add up their cost
+    if (const auto iterator = measured_parent_cost.find(cell->id());
+        iterator != measured_parent_cost.end())
+      {
+        return iterator->second;
+      }
+
+    return 0.0;
+  }
+
+  /**
+   * @brief Report the load imbalance with the cell weights and repartition the grid if
+   * it exceeds the threshold.
+   *
+   * The imbalance is the ratio of the maximum to the average load over the processes.
+   * Until the cost of the cells is known, for example during the initial refinement with
+   * measured weights, the load is the number of cells, so the grid is still partitioned
+   * by cell count like the unweighted grids.
+   *
+   * @return Whether the grid was repartitioned.
+   */
+  bool
+  balance_load()
+  {
+    const auto &spatial_discretization =
+      grid_refinement_context.get_user_inputs().get_spatial_discretization();
+    if (spatial_discretization.get_cell_weighting() == GridRefinement::Uniform)
+      {
+        return false;
+      }
+
+    // Compute the load of this process
+    double       local_load  = 0.0;
+    unsigned int local_cells = 0;
+    for (const auto &cell : grid_refinement_context.get_triangulation_handler()
+                              .get_triangulation()
+                              .active_cell_iterators())
+      {
+        if (cell->is_locally_owned())
+          {
+            local_load += compute_cell_cost(cell);
+            local_cells++;
           }
       }
+
+    const auto load = dealii::Utilities::MPI::min_max_avg(local_load, MPI_COMM_WORLD);
+    const auto cells =
+      dealii::Utilities::MPI::min_max_avg(static_cast<double>(local_cells),
+                                          MPI_COMM_WORLD);
+
+    // Nothing has been measured yet, so balance the number of cells
+    const bool has_cost = load.sum > 0.0;
+
+    const double imbalance = has_cost ? load.max / load.avg : cells.max / cells.avg;
+    ConditionalOStreams::pout_base() << "  load imbalance: " << imbalance << "\n"
+                                     << std::flush;
+
+    if (imbalance <= spatial_discretization.get_imbalance_threshold())
+      {
+        return false;
+      }
+
+    // Weight the cells relative to the average cost. Cells with no cost get the smallest
+    // weight so they are still accounted for. Without costs, every cell has the same
+    // weight.
+    if (has_cost)
+      {
+        const double average_cost = load.sum / cells.sum;
+        grid_refinement_context.get_triangulation_handler().set_cell_weight_function(
+          [this, average_cost](const CellIterator &cell)
+          {
+            return std::max(1U,
+                            static_cast<unsigned int>(
+                              std::round(relative_weight * compute_cell_cost(cell) /
+                                         average_cost)));
+          });
+      }
+    else
+      {
+        grid_refinement_context.get_triangulation_handler().set_cell_weight_function(
+          []([[maybe_unused]] const CellIterator &cell)
+          {
+            return 1U;
+          });
+      }
+
+    ConditionalOStreams::pout_base() << "  repartitioning grid...\n" << std::flush;
+    grid_refinement_context.get_solution_handler().prepare_for_solution_transfer();
+    grid_refinement_context.get_triangulation_handler().repartition();
+    reinit_after_grid_change();
+
+    return true;
   }
 
   /**
    * @brief Refine the grid
+   *
+   * @return Whether any cell was flagged for refinement or coarsening on any process.
    */
-  void
+  bool
   refine_grid()
   {
     // Prepare for grid refinement
     grid_refinement_context.get_triangulation_handler().prepare_for_grid_refinement();
 
+    // Skip the refinement if no cells are flagged. This is checked after preparing the
+    // refinement since that may remove some flags.
+    if (!grid_refinement_context.get_triangulation_handler().has_refinement_flags())
+      {
+        ConditionalOStreams::pout_base() << "  no cells flagged, skipping refinement\n"
+                                         << std::flush;
+        return false;
+      }
+
     // Prepare the solution transfer objects
     grid_refinement_context.get_solution_handler().prepare_for_solution_transfer();
 
     // Execute grid refinement
     grid_refinement_context.get_triangulation_handler().execute_grid_refinement();
+
+    return true;
   }
 
   /**
@@ -420,35 +1050,47 @@ private:
   GridRefinementContext<dim, degree, number> grid_refinement_context;
 
   /**
-   * @brief Update flags for the FEValues object as determined by the grid refinement
-   * criterion.
+   * @brief Number of quadrature points.
    */
-  std::vector<dealii::UpdateFlags> fe_values_flags;
+  unsigned int num_quad_points = 0;
 
   /**
-   * @brief Finite element systems for scalar and vector fields.
+   * @brief Maximum global refinement level.
    */
-  std::unordered_map<FieldType, dealii::FESystem<dim>> fe_systems;
+  unsigned int max_refinement = 0;
 
   /**
-   * @brief Finite element values for scalar and vector fields.
+   * @brief Minimum global refinement level.
    */
-  std::unordered_map<FieldType, dealii::FEValues<dim>> fe_values;
+  unsigned int min_refinement = 0;
 
   /**
-   * @brief Number of quadrature points.
+   * @brief The measured cost of each locally owned cell before the last refinement.
    */
-  unsigned int num_quad_points = 0;
+  std::map<dealii::CellId, double> measured_cell_cost;
 
   /**
-   * @brief Maximum global refinement level.
+   * @brief The summed measured cost of the children of each parent cell before the last
+   * refinement.
    */
-  unsigned int max_refinement = 0;
+  std::map<dealii::CellId, double> measured_parent_cost;
 
   /**
-   * @brief Minimum global refinement level.
+   * @brief Whether each lane of each cell batch is skipped by the check of the remeshing
+   * event, because its cell is not next to the refined region. This is cached between
+   * grid changes.
    */
-  unsigned int min_refinement = 0;
+  dealii::Vector<number> skipped_lanes;
+
+  /**
+   * @brief The number of lanes of this process that are next to the refined region.
+   */
+  unsigned int n_lanes_next_to_refined_region = 0;
+
+  /**
+   * @brief The weight of a cell with the average cost.
+   */
+  static constexpr double relative_weight = 1000.0;
 };
 
 PRISMS_PF_END_NAMESPACE
@@ -11,6 +11,7 @@
 #include <prismspf/core/dof_handler.h>
 #include <prismspf/core/invm_handler.h>
 #include <prismspf/core/matrix_free_handler.h>
+#include <prismspf/core/pde_operator.h>
 #include <prismspf/core/solution_handler.h>
 #include <prismspf/core/triangulation_handler.h>
 
@@ -20,6 +21,9 @@
 
 #include <prismspf/config.h>
 
+#include <memory>
+#include <utility>
+
 PRISMS_PF_BEGIN_NAMESPACE
 
 /**
@@ -38,17 +42,18 @@ public:
    * @brief Constructor.
    */
   GridRefinementContext(
-    const UserInputParameters<dim>              &_user_inputs,
-    TriangulationHandler<dim>                   &_triangulation_handler,
-    ConstraintHandler<dim, degree, number>      &_constraint_handler,
-    MatrixFreeContainer<dim, number>            &_matrix_free_container,
-    InvmHandler<dim, degree, number>            &_invm_handler,
-    SolutionHandler<dim, number>                &_solution_handler,
-    DofHandler<dim>                             &_dof_handler,
-    std::map<FieldType, dealii::FESystem<dim>>  &_fe_system,
-    const dealii::MappingQ1<dim>                &_mapping,
-    ElementVolumeContainer<dim, degree, number> &_element_volume_container,
-    const MGInfo<dim>                           &_mg_info)
+    const UserInputParameters<dim>                         &_user_inputs,
+    TriangulationHandler<dim>                              &_triangulation_handler,
+    ConstraintHandler<dim, degree, number>                 &_constraint_handler,
+    MatrixFreeContainer<dim, number>                       &_matrix_free_container,
+    InvmHandler<dim, degree, number>                       &_invm_handler,
+    SolutionHandler<dim, number>                           &_solution_handler,
+    DofHandler<dim>                                        &_dof_handler,
+    std::map<FieldType, dealii::FESystem<dim>>             &_fe_system,
+    const dealii::MappingQ1<dim>                           &_mapping,
+    ElementVolumeContainer<dim, degree, number>            &_element_volume_container,
+    const MGInfo<dim>                                      &_mg_info,
+    std::shared_ptr<const PDEOperator<dim, degree, number>> _pde_operator)
     : user_inputs(&_user_inputs)
     , triangulation_handler(&_triangulation_handler)
     , constraint_handler(&_constraint_handler)
@@ -59,7 +64,8 @@ public:
     , fe_system(&_fe_system)
     , mapping(&_mapping)
     , element_volume_container(&_element_volume_container)
-    , mg_info(&_mg_info) {};
+    , mg_info(&_mg_info)
+    , pde_operator(std::move(_pde_operator)) {};
 
   /**
    * @brief Destructor.
@@ -178,6 +184,16 @@ public:
     return *mg_info;
   }
 
+  /**
+   * @brief Get the pde operator.
+   */
+  [[nodiscard]] const PDEOperator<dim, degree, number> &
+  get_pde_operator() const
+  {
+    Assert(pde_operator != nullptr, dealii::ExcNotInitialized());
+    return *pde_operator;
+  }
+
 private:
   /**
    * @brief User-inputs.
@@ -235,6 +251,11 @@ private:
    * @brief Multigrid information
    */
   const MGInfo<dim> *mg_info;
+
+  /**
+   * @brief PDE operator.
+   */
+  std::shared_ptr<const PDEOperator<dim, degree, number>> pde_operator;
 };
 
 PRISMS_PF_END_NAMESPACE
\ No newline at end of file
@@ -36,6 +36,83 @@ namespace GridRefinement
      * @brief Use gradient of the variable as a criterion for refinement.
      */
     Gradient = 0x0002,
+
+    /**
+     * @brief Use the Kelly error estimator (jump of the normal gradient across faces) as
+     * an error indicator for refinement.
+     */
+    Kelly = 0x0004,
+
+    /**
+     * @brief Use the approximate second derivative of the variable, scaled by the cell
+     * size, as an error indicator for refinement.
+     */
+    Curvature = 0x0008,
+  };
+
+  /**
+   * @brief Strategies for marking cells for refinement and coarsening.
+   */
+  enum MarkingStrategy : std::uint8_t
+  {
+    /**
+     * @brief Refine cells where the value or gradient criteria are met and coarsen
+     * everywhere else.
+     */
+    Threshold,
+
+    /**
+     * @brief Refine and coarsen the cells that make up a fixed fraction of the total
+     * estimated error.
+     */
+    FixedFraction,
+
+    /**
+     * @brief Refine and coarsen a fixed fraction of the cells, ranked by their estimated
+     * error, while capping the total number of cells.
+     */
+    FixedNumber,
+  };
+
+  /**
+   * @brief Events that trigger remeshing.
+   */
+  enum RemeshingTrigger : std::uint8_t
+  {
+    /**
+     * @brief Remesh every remeshing period steps.
+     */
+    Period,
+
+    /**
+     * @brief Remesh when the refinement criteria are met on the cells next to the
+     * region at the maximum refinement level, in addition to every remeshing period
+     * steps.
+     */
+    Event,
+  };
+
+  /**
+   * @brief Sources of the cell weights used to partition the mesh.
+   */
+  enum CellWeighting : std::uint8_t
+  {
+    /**
+     * @brief Every cell has the same weight, so the partition balances the number of
+     * cells. The mesh is repartitioned every time it is refined.
+     */
+    Uniform,
+
+    /**
+     * @brief The cell weights are given by the user through the PDE operator.
+     */
+    User,
+
+    /**
+     * @brief The cell weights are given by the measured cost of evaluating each cell
+     * batch since the last remesh.
+     */
+    Measured,
   };
 
   // Function that enables bitwise OR between flags
@@ -215,6 +292,16 @@ namespace GridRefinement
       return gradient_magnitude > gradient_lower_bound;
     }
 
+    /**
+     * @brief Whether the criterion is an error indicator, as opposed to a value or
+     * gradient threshold.
+     */
+    [[nodiscard]] bool
+    is_error_indicator() const
+    {
+      return (criterion & (RefinementFlags::Kelly | RefinementFlags::Curvature)) != 0U;
+    }
+
     /**
      * @brief Convert refinement criterion type to string.
      */
@@ -238,6 +325,14 @@ namespace GridRefinement
         {
           return "Gradient";
         }
+      if ((criterion & RefinementFlags::Kelly) != 0U)
+        {
+          return "Kelly";
+        }
+      if ((criterion & RefinementFlags::Curvature) != 0U)
+        {
+          return "Curvature";
+        }
 
       return "Unknown criterion";
     }
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#pragma once
+
+#include <deal.II/base/point.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/grid/tria_description.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <prismspf/config.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+template <unsigned int dim>
+class UserInputParameters;
+
+/**
+ * @brief Class that extracts the isosurfaces of selected scalar fields and writes them to
+ * vtp and pvtp files.
+ *
+ * Each process runs marching cubes (marching squares in 2D) over the subdivided cells it
+ * owns and writes its piece of the surface mesh without any communication. The first
+ * process writes the pvtp record. The surfaces are a small fraction of the size of the
+ * full fields, so they can be written much more often.
+ */
+template <unsigned int dim, typename number>
+class IsosurfaceOutput
+{
+public:
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<number>;
+
+  /**
+   * @brief Constructor. This writes the isosurfaces of every selected field.
+   */
+  IsosurfaceOutput(const std::map<unsigned int, VectorType *>         &solution_set,
+                   const std::vector<const dealii::DoFHandler<dim> *> &dof_handlers,
+                   const dealii::Mapping<dim>                         &mapping,
+                   const unsigned int                                 &degree,
+                   const std::string                                  &name,
+                   const UserInputParameters<dim>                     &user_inputs);
+
+private:
+  /**
+   * @brief The surface mesh of the isosurfaces of a field on this process.
+   */
+  struct SurfaceMesh
+  {
+    /**
+     * @brief The vertices of the surface mesh.
+     */
+    std::vector<dealii::Point<dim>> vertices;
+
+    /**
+     * @brief The cells of the surface mesh. These are points in 1D, lines in 2D, and
+     * triangles in 3D.
+     */
+    std::vector<dealii::CellData<dim == 1 ? 1 : dim - 1>> cells;
+
+    /**
+     * @brief The isovalue of each vertex.
+     */
+    std::vector<double> isovalues;
+  };
+
+  /**
+   * @brief Write the piece of a surface mesh on this process to a vtp file.
+   */
+  static void
+  write_vtp(const SurfaceMesh &surface, const std::string &filename);
+
+  /**
+   * @brief Write the pvtp record that collects the pieces of all processes.
+   */
+  static void
+  write_pvtp(const std::vector<std::string> &piece_names, const std::string &filename);
+};
+
+PRISMS_PF_END_NAMESPACE
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <deal.II/base/thread_management.h>
 #include <deal.II/base/vectorization.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/matrix_free/matrix_free.h>
@@ -13,6 +14,10 @@
 
 #include <prismspf/config.h>
 
+#include <map>
+#include <string>
+#include <utility>
+
 #if DEAL_II_VERSION_MAJOR >= 9 && DEAL_II_VERSION_MINOR >= 7
 #  include <deal.II/base/enable_observer_pointer.h>
 #  define MATRIX_FREE_OPERATOR_BASE dealii::EnableObserverPointer
@@ -162,12 +167,23 @@ public:
                           const std::vector<VectorType *> &src) const;
 
   /**
-   * @brief Compute the explicit update for postprocessed fields.
+   * @brief Compute the explicit update for postprocessed fields. The reductions that are
+   * accumulated in the kernel are combined across threads and processes afterwards.
    */
   void
   compute_postprocess_explicit_update(std::vector<VectorType *>       &dst,
                                       const std::vector<VectorType *> &src) const;
 
+  /**
+   * @brief Get the reductions of the last postprocessed update, combined across all
+   * processes.
+   */
+  [[nodiscard]] const std::map<std::string, double> &
+  get_reductions() const
+  {
+    return reduction_values;
+  }
+
   /**
    * @brief Compute a nonexplicit auxiliary update.
    */
@@ -310,6 +326,22 @@ private:
    * @brief The inverse diagonal matrix.
    */
   std::shared_ptr<dealii::DiagonalMatrix<VectorType>> inverse_diagonal_entries;
+
+  /**
+   * @brief The reductions of this process, with their types, combined from the cell
+   * ranges of each thread.
+   */
+  mutable std::map<std::string, std::pair<ReductionType, double>> local_reductions;
+
+  /**
+   * @brief Mutex that guards the reductions of this process.
+   */
+  mutable dealii::Threads::Mutex reduction_mutex;
+
+  /**
+   * @brief The reductions combined across all processes.
+   */
+  mutable std::map<std::string, double> reduction_values;
 };
 
 PRISMS_PF_END_NAMESPACE
@@ -9,6 +9,8 @@
 
 #include <prismspf/config.h>
 
+#include <map>
+
 PRISMS_PF_BEGIN_NAMESPACE
 
 template <unsigned int dim>
@@ -95,6 +97,20 @@ public:
                                    const SizeType                         &element_volume,
                                    Types::Index solve_block) const = 0;
 
+  /**
+   * @brief User-implemented class for the relative cost of a cell, which weights the
+   * mesh partition when the cell weighting is set to user. The cell is described by its
+   * center and the average value of each field on the cell (the magnitude for vector
+   * fields). By default, all cells have the same cost.
+   */
+  [[nodiscard]] virtual number
+  compute_cell_weight([[maybe_unused]] const dealii::Point<dim> &cell_center,
+                      [[maybe_unused]] const std::map<Types::Index, number> &cell_average)
+    const
+  {
+    return 1.0;
+  }
+
   /**
    * @brief Get the user inputs (constant reference).
    */
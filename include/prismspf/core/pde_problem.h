@@ -13,6 +13,8 @@
 
 #include <prismspf/config.h>
 
+#include <chrono>
+
 PRISMS_PF_BEGIN_NAMESPACE
 
 template <unsigned int dim>
@@ -58,7 +60,15 @@ template <unsigned int dim, unsigned int degree, typename number>
 class ElementVolumeContainer;
 
 template <unsigned int dim, unsigned int degree, typename number>
-class Integrator;
+class SolutionStatistics;
+
+template <unsigned int dim, typename number>
+class AsyncSolutionOutput;
+
+template <unsigned int dim, typename number>
+class CheckpointHandler;
+
+struct XDMFRecord;
 
 /**
  * @brief This is the main class that handles the construction and solving of
@@ -96,6 +106,14 @@ private:
   void
   solve_increment();
 
+  /**
+   * @brief Advance the time by one increment. If the solution becomes non-finite, the
+   * increment is rolled back and retried with twice as many substeps, up to the maximum
+   * number of retries.
+   */
+  void
+  advance_increment();
+
   /**
    * @brief Initialize the system.
    */
@@ -108,6 +126,21 @@ private:
   void
   reinit_system();
 
+  /**
+   * @brief Write the solution fields to file, either directly or on the background
+   * thread.
+   */
+  void
+  write_solution_output();
+
+  /**
+   * @brief Whether to write a checkpoint and stop after this increment, either because a
+   * SIGTERM or SIGUSR1 signal was received or because the max wall time is near. This
+   * must be called by every process after every increment.
+   */
+  [[nodiscard]] bool
+  should_stop(double increment_seconds);
+
   /**
    * @brief User-inputs.
    */
@@ -170,11 +203,6 @@ private:
    */
   SolverContext<dim, degree, number> solver_context;
 
-  /**
-   * @brief Integrator utility.
-   */
-  Integrator<dim, degree, number> integrator;
-
   /**
    * @brief Grid refiner context.
    */
@@ -189,6 +217,36 @@ private:
    * @brief Solver handler.
    */
   SolverHandler<dim, degree, number> solver_handler;
+
+  /**
+   * @brief Asynchronous solution output.
+   */
+  AsyncSolutionOutput<dim, number> solution_output;
+
+  /**
+   * @brief Record of the HDF5 output steps.
+   */
+  XDMFRecord xdmf_record;
+
+  /**
+   * @brief Checkpoint handler.
+   */
+  CheckpointHandler<dim, number> checkpoint_handler;
+
+  /**
+   * @brief Statistics of the solution fields.
+   */
+  SolutionStatistics<dim, degree, number> solution_statistics;
+
+  /**
+   * @brief The wall time at which the simulation started.
+   */
+  std::chrono::steady_clock::time_point start_time;
+
+  /**
+   * @brief Moving average of the wall time per increment.
+   */
+  double average_increment_seconds = 0.0;
 };
 
 PRISMS_PF_END_NAMESPACE
@@ -106,6 +106,12 @@ public:
   void
   update_ghosts() const;
 
+  /**
+   * @brief Update the ghost values of the current solution of a given field index.
+   */
+  void
+  update_ghosts(unsigned int index) const;
+
   /**
    * @brief Zero out the ghost values.
    *
@@ -143,36 +149,101 @@ public:
          Types::Index   variable_index = 0);
 
   /**
-   * @brief Prepare for solution transfer
+   * @brief Store the current solution of a field before a nonexplicit solve updates it in
+   * place, so that it can become the OldOne solution afterwards.
+   *
+   * This copies into a preallocated history vector and is a no-op for fields without old
+   * solutions.
+   */
+  void
+  prepare_history(Types::Index index);
+
+  /**
+   * @brief Rotate the old solutions of a field after a nonexplicit solve. The solution
+   * stored by prepare_history() becomes OldOne, OldOne becomes OldTwo, and so on.
+   *
+   * The rotation only swaps the storage of the vectors, so it is O(1) and the pointers
+   * held by the solvers stay valid.
+   */
+  void
+  rotate_history(Types::Index index);
+
+  /**
+   * @brief Scale the new solution of a field entrywise by the given vector. Whether the
+   * result is finite is checked in the same pass and replaces the previous check of the
+   * new solution, see solution_is_finite().
+   */
+  void
+  scale_new_solution(unsigned int index, const VectorType &scaling);
+
+  /**
+   * @brief Add a multiple of an update to the solution of a field. Whether the result is
+   * finite is checked in the same pass and replaces the previous check of the solution,
+   * so a rejected line search step that is later backtracked does not count, see
+   * solution_is_finite().
    */
   void
-  prepare_for_solution_transfer()
+  add_to_solution(unsigned int index, number factor, const VectorType &update);
+
+  /**
+   * @brief Whether the solutions that were updated since the last call to
+   * reset_finite_check() were finite after their latest update on every process. This
+   * must be called by every process.
+   */
+  [[nodiscard]] bool
+  solution_is_finite() const;
+
+  /**
+   * @brief Reset the check of whether the updates are finite.
+   */
+  void
+  reset_finite_check()
   {
-    Assert(solution_transfer_set.size() == solution_set.size(),
-           dealii::ExcInternalError());
-    for (auto &[pair, solution] : solution_set)
-      {
-        auto &transfer = solution_transfer_set.at(pair);
-        Assert(transfer, dealii::ExcInternalError());
-        transfer->prepare_for_coarsening_and_refinement(*solution);
-      }
+    finite_solutions.clear();
+    finite_new_solutions.clear();
   }
 
+  /**
+   * @brief Copy the solution vectors, including the old solutions, so that they can be
+   * restored with restore_snapshot().
+   */
+  void
+  save_snapshot();
+
+  /**
+   * @brief Restore the solution vectors from the last snapshot. The grid must not have
+   * changed since the snapshot was saved.
+   */
+  void
+  restore_snapshot();
+
+  /**
+   * @brief Prepare for solution transfer. All vectors of a field, including its old
+   * solutions, are attached to the triangulation with a single transfer object, so the
+   * data is packed and redistributed once per DoFHandler.
+   */
+  void
+  prepare_for_solution_transfer();
+
   /**
    * @brief Transfer solutions
    */
   void
-  execute_solution_transfer()
-  {
-    Assert(solution_transfer_set.size() == solution_set.size(),
-           dealii::ExcInternalError());
-    for (auto &[pair, solution] : solution_set)
-      {
-        auto &transfer = solution_transfer_set.at(pair);
-        Assert(transfer, dealii::ExcInternalError());
-        transfer->interpolate(*solution);
-      }
-  }
+  execute_solution_transfer();
+
+  /**
+   * @brief Attach all solution vectors, including the old solutions, to the
+   * triangulation so they are written when it is saved to a checkpoint.
+   */
+  void
+  prepare_for_serialization();
+
+  /**
+   * @brief Read the solution vectors from the data attached to a triangulation that was
+   * loaded from a checkpoint. The solution set must be initialized on the loaded mesh.
+   */
+  void
+  deserialize();
 
   /**
    * @brief Free solution transfer objects.
@@ -180,7 +251,7 @@ public:
   void
   free_solution_transfer()
   {
-    for (auto &[pair, ptr] : solution_transfer_set)
+    for (auto &[index, ptr] : solution_transfer_set)
       {
         ptr.reset();
       }
@@ -194,6 +265,12 @@ public:
   reinit_solution_transfer(MatrixFreeContainer<dim, number> &matrix_free_container);
 
 private:
+  /**
+   * @brief Rotate the spare vector through the old solutions of a field.
+   */
+  void
+  rotate_old_solutions(Types::Index index, VectorType &spare);
+
   /**
    * @brief The attribute list of the relevant variables.
    */
@@ -232,10 +309,10 @@ private:
 #endif
 
   /**
-   * @brief The collection of solution transfer objects at the current timestep.
+   * @brief The solution transfer object of each field. Each one transfers the current
+   * and old solutions of the field.
    */
-  std::map<std::pair<unsigned int, DependencyType>, std::unique_ptr<SolutionTransfer>>
-    solution_transfer_set;
+  std::map<unsigned int, std::unique_ptr<SolutionTransfer>> solution_transfer_set;
 
   /**
    * @brief The collection of new solution vectors at the current timestep. This is the
@@ -244,6 +321,30 @@ private:
    */
   std::map<unsigned int, std::unique_ptr<VectorType>> new_solution_set;
 
+  /**
+   * @brief The spare history vector of each field with old solutions. This is the slot
+   * of the history ring buffer that is recycled on each rotation.
+   */
+  std::map<unsigned int, std::unique_ptr<VectorType>> history_set;
+
+  /**
+   * @brief The copy of the solution vectors, including the old solutions, from the last
+   * snapshot.
+   */
+  std::map<std::pair<unsigned int, DependencyType>, VectorType> snapshot_set;
+
+  /**
+   * @brief Whether the solution of each field was finite on this process after its
+   * latest update.
+   */
+  std::map<unsigned int, bool> finite_solutions;
+
+  /**
+   * @brief Whether the new solution of each field was finite on this process after its
+   * latest scaling.
+   */
+  std::map<unsigned int, bool> finite_new_solutions;
+
   /**
    * @brief The collection of solution vectors at the current timestep for the multigrid
    * hierarchy.
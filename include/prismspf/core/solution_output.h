@@ -3,11 +3,16 @@
 
 #pragma once
 
+#include <deal.II/base/data_out_base.h>
+#include <deal.II/dofs/dof_handler.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/numerics/data_out.h>
 
 #include <prismspf/config.h>
 
+#include <map>
 #include <string>
+#include <vector>
 
 PRISMS_PF_BEGIN_NAMESPACE
 
@@ -15,7 +20,39 @@ template <unsigned int dim>
 class UserInputParameters;
 
 /**
- * @brief Class that outputs a passed solution to vtu, vtk, or pvtu
+ * @brief Record of the HDF5 output steps, used to write the XDMF file that indexes them.
+ */
+struct XDMFRecord
+{
+  /**
+   * @brief The XDMF entries of the steps that have been written.
+   */
+  std::vector<dealii::XDMFEntry> entries;
+
+  /**
+   * @brief The HDF5 file that holds the last mesh that was written.
+   */
+  std::string mesh_filename;
+
+  /**
+   * @brief Whether the mesh changed since it was last written.
+   */
+  bool mesh_changed = true;
+
+  /**
+   * @brief Serialize the steps for a checkpoint. Whether the mesh changed is not saved,
+   * since the mesh is rewritten after a restart.
+   */
+  template <class Archive>
+  void
+  serialize(Archive &archive, [[maybe_unused]] const unsigned int version)
+  {
+    archive & entries & mesh_filename;
+  }
+};
+
+/**
+ * @brief Class that outputs a passed solution to vtu, vtk, pvtu, or hdf5
  */
 template <unsigned int dim, typename number>
 class SolutionOutput
@@ -39,7 +76,38 @@ public:
                  const std::vector<const dealii::DoFHandler<dim> *> &dof_handlers,
                  const unsigned int                                 &degree,
                  const std::string                                  &name,
-                 const UserInputParameters<dim>                     &user_inputs);
+                 const UserInputParameters<dim>                     &user_inputs,
+                 XDMFRecord *xdmf_record = nullptr);
+
+  /**
+   * @brief Add the fields of a solution set to a DataOut object. The solution vectors
+   * must have their ghost values updated.
+   */
+  static void
+  add_data_vectors(dealii::DataOut<dim>                               &data_out,
+                   const std::map<unsigned int, VectorType *>         &solution_set,
+                   const std::vector<const dealii::DoFHandler<dim> *> &dof_handlers,
+                   const UserInputParameters<dim>                     &user_inputs);
+
+  /**
+   * @brief Build the patches of a DataOut object and write them to file.
+   *
+   * If the call is collective, every process writes the same output at once. Otherwise,
+   * as on the asynchronous output thread, only the pvtu and vtk file types can be
+   * written, and the rank and number of processes are passed in so the pvtu pieces are
+   * named without any communication. The hdf5 file type requires the XDMF record.
+   */
+  static void
+  write_patches(dealii::DataOut<dim>           &data_out,
+                const unsigned int             &degree,
+                const std::string              &name,
+                const unsigned int             &increment,
+                const double                   &time,
+                const unsigned int             &mpi_rank,
+                const unsigned int             &n_mpi_processes,
+                const bool                     &collective,
+                const UserInputParameters<dim> &user_inputs,
+                XDMFRecord                     *xdmf_record = nullptr);
 };
 
 PRISMS_PF_END_NAMESPACE
@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#pragma once
+
+#include <deal.II/base/vectorization.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <prismspf/utilities/integrator.h>
+
+#include <prismspf/config.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+template <unsigned int dim>
+class UserInputParameters;
+
+/**
+ * @brief Class that computes statistics of the solution fields and writes them to a
+ * time-series log.
+ *
+ * The integrals of every field are evaluated with the Integrator. The minima, maxima,
+ * phase volumes, and interface areas of every field are evaluated in a single matrix-free
+ * cell loop, and the per-process results of all fields are combined with a single
+ * reduction. The minima and maxima are taken at the quadrature
+ * points, which coincide with the support points of the elements. This replaces the
+ * offline VisIt scripts for the phase fraction and interface area, so the full fields do
+ * not need to be written to follow them.
+ */
+template <unsigned int dim, unsigned int degree, typename number>
+class SolutionStatistics
+{
+public:
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<number>;
+  using SizeType   = dealii::VectorizedArray<number>;
+
+  /**
+   * @brief The statistics of a field.
+   */
+  struct FieldStatistics
+  {
+    /**
+     * @brief The integral of each component.
+     */
+    std::vector<double> integral;
+
+    /**
+     * @brief The mean of each component over the domain.
+     */
+    std::vector<double> mean;
+
+    /**
+     * @brief The l2-norm of the solution vector.
+     */
+    double l2_norm = 0.0;
+
+    /**
+     * @brief The minimum of the field, or of its magnitude for vector fields.
+     */
+    double min = 0.0;
+
+    /**
+     * @brief The maximum of the field, or of its magnitude for vector fields.
+     */
+    double max = 0.0;
+
+    /**
+     * @brief The volume fraction of the domain where a scalar field exceeds the phase
+     * fraction threshold.
+     */
+    double phase_fraction = 0.0;
+
+    /**
+     * @brief The integral of the gradient magnitude of a scalar field. For an order
+     * parameter that goes from 0 to 1 across the interface, this is the interface area
+     * (or length in 2D).
+     */
+    double interface_area = 0.0;
+  };
+
+  /**
+   * @brief Constructor.
+   */
+  explicit SolutionStatistics(const UserInputParameters<dim> &_user_inputs);
+
+  /**
+   * @brief Compute the statistics of the solution fields. This must be called by every
+   * process.
+   */
+  void
+  compute(const std::shared_ptr<dealii::MatrixFree<dim, number, SizeType>> &data,
+          const std::map<unsigned int, VectorType *>                       &solution_set);
+
+  /**
+   * @brief Get the statistics of each field from the last computation.
+   */
+  [[nodiscard]] const std::map<unsigned int, FieldStatistics> &
+  get_statistics() const
+  {
+    return statistics;
+  }
+
+  /**
+   * @brief Set the named reductions of the postprocess kernels that are printed and
+   * logged with the statistics.
+   */
+  void
+  set_reductions(const std::map<std::string, double> &_reductions)
+  {
+    reductions = _reductions;
+  }
+
+  /**
+   * @brief Print the statistics to the screen.
+   */
+  void
+  print() const;
+
+  /**
+   * @brief Append the statistics to the time-series log, statistics.csv.
+   */
+  void
+  write_log() const;
+
+private:
+  /**
+   * @brief Accumulate the volume of a range of cell batches in the first slot of each
+   * cell batch.
+   */
+  void
+  accumulate_cell_volumes(
+    const dealii::MatrixFree<dim, number, SizeType> &data,
+    unsigned int                                     n_values_per_batch,
+    dealii::Vector<double>                          &batch_values,
+    const std::pair<unsigned int, unsigned int>     &cell_range) const;
+
+  /**
+   * @brief Accumulate the extrema, the phase volume, and the interface area of a field on
+   * a range of cell batches. The values of each cell batch are written to its own slots
+   * of batch_values, starting at the given offset. The gradients are only evaluated if
+   * the interface area is computed.
+   */
+  template <unsigned int n_components>
+  void
+  accumulate_cell_batches(
+    const dealii::MatrixFree<dim, number, SizeType> &data,
+    unsigned int                                     index,
+    const VectorType                                &solution,
+    unsigned int                                     offset,
+    unsigned int                                     n_values_per_batch,
+    bool                                             compute_interface_area,
+    number                                           threshold,
+    dealii::Vector<double>                          &batch_values,
+    const std::pair<unsigned int, unsigned int>     &cell_range) const;
+
+  /**
+   * @brief User-inputs.
+   */
+  const UserInputParameters<dim> *user_inputs;
+
+  /**
+   * @brief The integrator of the fields.
+   */
+  Integrator<dim, degree, number> integrator;
+
+  /**
+   * @brief The statistics of each field from the last computation.
+   */
+  std::map<unsigned int, FieldStatistics> statistics;
+
+  /**
+   * @brief The named reductions of the postprocess kernels.
+   */
+  std::map<std::string, double> reductions;
+};
+
+PRISMS_PF_END_NAMESPACE
@@ -8,6 +8,7 @@
 #include <prismspf/solvers/concurrent_constant_solver.h>
 #include <prismspf/solvers/concurrent_explicit_postprocess_solver.h>
 #include <prismspf/solvers/concurrent_explicit_solver.h>
+#include <prismspf/solvers/monolithic_co_nonlinear_solver.h>
 #include <prismspf/solvers/sequential_auxiliary_solver.h>
 #include <prismspf/solvers/sequential_co_nonlinear_solver.h>
 #include <prismspf/solvers/sequential_linear_solver.h>
@@ -17,6 +18,7 @@
 
 #include <map>
 #include <set>
+#include <string>
 
 PRISMS_PF_BEGIN_NAMESPACE
 
@@ -91,12 +93,24 @@ public:
   void
   solve(unsigned int increment, bool update_postprocessed);
 
+  /**
+   * @brief Get the reductions of the postprocessed fields from the last time they were
+   * solved, for all solve blocks.
+   */
+  [[nodiscard]] std::map<std::string, double>
+  get_reductions();
+
 private:
   /**
    * @brief Set of solve blocks that we have.
    */
   std::set<Types::Index> solve_blocks;
 
+  /**
+   * @brief Whether the co-nonlinear fields are solved as one block system.
+   */
+  bool use_monolithic_solve = false;
+
   /**
    * @brief Explicit constant field solver class.
    */
@@ -138,6 +152,13 @@ private:
    */
   std::map<Types::Index, SequentialCoNonlinearSolver<dim, degree, number>>
     sequential_co_nonlinear_solver;
+
+  /**
+   * @brief Nonexplicit co-nonlinear field solver class that solves all fields as one
+   * block system.
+   */
+  std::map<Types::Index, MonolithicCoNonlinearSolver<dim, degree, number>>
+    monolithic_co_nonlinear_solver;
 };
 
 PRISMS_PF_END_NAMESPACE
\ No newline at end of file
@@ -5,10 +5,14 @@
 
 #include <deal.II/distributed/tria.h>
 #include <deal.II/grid/tria.h>
+#include <deal.II/lac/vector.h>
 #include <deal.II/multigrid/mg_transfer_global_coarsening.h>
 
 #include <prismspf/config.h>
 
+#include <boost/signals2/connection.hpp>
+
+#include <functional>
 #include <string>
 
 PRISMS_PF_BEGIN_NAMESPACE
@@ -34,6 +38,9 @@ public:
                        dealii::Triangulation<dim>,
                        dealii::parallel::distributed::Triangulation<dim>>;
 
+  using CellIterator       = typename dealii::Triangulation<dim>::cell_iterator;
+  using CellWeightFunction = std::function<unsigned int(const CellIterator &)>;
+
   /**
    * @brief Constructor.
    */
@@ -107,9 +114,20 @@ public:
 
   /**
    * @brief Generate mesh based on the inputs provided by the user.
+   *
+   * If a checkpoint filename is given, the refined mesh and the data attached to it are
+   * loaded from the checkpoint instead of globally refining the coarse mesh. The
+   * checkpoint can be loaded with a different number of processes than it was saved
+   * with.
+   */
+  void
+  generate_mesh(const std::string &checkpoint_filename = "");
+
+  /**
+   * @brief Save the triangulation and the data attached to it to a checkpoint.
    */
   void
-  generate_mesh();
+  save(const std::string &filename) const;
 
   /**
    * @brief Export triangulation to vtk. This is done for debugging purposes when dealing
@@ -128,6 +146,13 @@ public:
     triangulation->prepare_coarsening_and_refinement();
   }
 
+  /**
+   * @brief Whether any locally owned cell on any process is flagged for refinement or
+   * coarsening. This is a collective operation.
+   */
+  [[nodiscard]] bool
+  has_refinement_flags() const;
+
   /**
    * @brief Execute grid refinement on the triangulation.
    */
@@ -138,6 +163,38 @@ public:
     triangulation->execute_coarsening_and_refinement();
   }
 
+  /**
+   * @brief Mark cells for refinement and coarsening such that the refined and coarsened
+   * cells each make up a fixed fraction of the total estimated error.
+   */
+  void
+  refine_and_coarsen_fixed_fraction(const dealii::Vector<float> &estimated_error,
+                                    double                       refine_fraction,
+                                    double                       coarsen_fraction);
+
+  /**
+   * @brief Mark a fixed fraction of the cells, ranked by their estimated error, for
+   * refinement and coarsening while keeping the total number of cells below a maximum.
+   */
+  void
+  refine_and_coarsen_fixed_number(const dealii::Vector<float> &estimated_error,
+                                  double                       refine_fraction,
+                                  double                       coarsen_fraction,
+                                  unsigned int                 max_n_cells);
+
+  /**
+   * @brief Set the function that gives the weight of each cell when partitioning the
+   * mesh. The weights are relative to each other.
+   */
+  void
+  set_cell_weight_function(const CellWeightFunction &cell_weight);
+
+  /**
+   * @brief Repartition the mesh according to the cell weights without refining it.
+   */
+  void
+  repartition();
+
   /**
    * @brief CLear all user flags.
    */
@@ -175,6 +232,11 @@ private:
    */
   std::shared_ptr<Triangulation> triangulation;
 
+  /**
+   * @brief Connection of the cell weight function to the triangulation.
+   */
+  boost::signals2::connection cell_weight_connection;
+
   /**
    * @brief Collection of triangulations for each multigrid level.
    *
@@ -94,7 +94,8 @@ enum DependencyType : std::uint8_t
 enum SolverToleranceType : std::uint8_t
 {
   AbsoluteResidual,
-  RelativeResidualChange
+  RelativeResidualChange,
+  AbsoluteSolutionChange
 };
 
 /**
@@ -106,6 +107,16 @@ enum PreconditionerType : std::uint8_t
   GMG
 };
 
+/**
+ * @brief Type of scalar reduction that is accumulated in a postprocess kernel.
+ */
+enum ReductionType : std::uint8_t
+{
+  Sum,
+  Minimum,
+  Maximum
+};
+
 /**
  * @brief Enum to string for FieldType
  */
@@ -253,6 +264,8 @@ to_string(SolverToleranceType type)
         return "AbsoluteResidual";
       case SolverToleranceType::RelativeResidualChange:
         return "RelativeResidualChange";
+      case SolverToleranceType::AbsoluteSolutionChange:
+        return "AbsoluteSolutionChange";
       default:
         return "UNKNOWN";
     }
@@ -124,6 +124,16 @@ protected:
   void
   set_is_postprocessed_field(const unsigned int &index, const bool &is_postprocess);
 
+  /**
+   * @brief Set whether the field is written to the solution output. By default, every
+   * field is written.
+   *
+   * @param index Index of variable
+   * @param is_output Whether the field is written.
+   */
+  void
+  set_is_output_field(const unsigned int &index, const bool &is_output);
+
   /**
    * @brief Set the solve block of the field.
    *
@@ -123,6 +123,15 @@ struct VariableAttributes
     return is_postprocessed_variable;
   }
 
+  /**
+   * @brief Whether the field is written to the solution output.
+   */
+  [[nodiscard]] bool
+  is_output() const
+  {
+    return is_output_variable;
+  }
+
   /**
    * @brief Get the solve block.
    */
@@ -350,6 +359,12 @@ private:
    */
   bool is_postprocessed_variable = false;
 
+  /**
+   * @brief Whether the field is written to the solution output.
+   * @remark User-set
+   */
+  bool is_output_variable = true;
+
   /**
    * @brief Solve block
    * @remark User-set
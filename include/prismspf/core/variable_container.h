@@ -15,6 +15,8 @@
 
 #include <prismspf/config.h>
 
+#include <map>
+#include <string>
 #include <type_traits>
 #include <variant>
 
@@ -841,6 +843,27 @@ public:
       }
   }
 
+  /**
+   * @brief Accumulate a value at the current quadrature point into a named scalar
+   * reduction. Sums are weighted by the JxW value, so they integrate the value over the
+   * domain. Minima and maxima are taken over the quadrature points. This is only
+   * available when computing postprocessed fields.
+   */
+  void
+  add_reduction(const std::string &name,
+                const SizeType    &value,
+                ReductionType      type = ReductionType::Sum);
+
+  /**
+   * @brief Get the reductions accumulated over the cells this object has evaluated. The
+   * value of each reduction is paired with its type.
+   */
+  [[nodiscard]] const std::map<std::string, std::pair<ReductionType, double>> &
+  get_reductions() const
+  {
+    return reductions;
+  }
+
   /**
    * @brief Apply some operator function for a given cell range and source vector to
    * some destination vector.
@@ -990,6 +1013,19 @@ private:
   [[nodiscard]] dealii::Point<dim, SizeType>
   get_q_point_location() const;
 
+  /**
+   * @brief Return the JxW value at the quadrature point.
+   */
+  [[nodiscard]] SizeType
+  get_jxw() const;
+
+  /**
+   * @brief Combine the lanes of the cell batch that hold cells into the reductions and
+   * reset the per-cell values.
+   */
+  void
+  finalize_cell_reductions(unsigned int cell);
+
   /**
    * @brief Initialize, read DOFs, and set evaulation flags for each variable.
    */
@@ -1121,6 +1157,21 @@ private:
    * @brief Diagonal matrix that is used for preconditioning of fields.
    */
   VariantDiagonal diagonal;
+
+  /**
+   * @brief Matrix-free object.
+   */
+  const dealii::MatrixFree<dim, number, SizeType> *matrix_free;
+
+  /**
+   * @brief The values of the reductions on the current cell batch.
+   */
+  std::map<std::string, std::pair<ReductionType, SizeType>> cell_reductions;
+
+  /**
+   * @brief The reductions accumulated over the evaluated cells.
+   */
+  std::map<std::string, std::pair<ReductionType, double>> reductions;
 };
 
 PRISMS_PF_END_NAMESPACE
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#pragma once
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <prismspf/config.h>
+
+#include <deque>
+#include <vector>
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+/**
+ * @brief Anderson acceleration (also known as DIIS) of a fixed-point iteration x = G(x)
+ * over a stacked set of field vectors.
+ *
+ * Given the iterate x_k before the fixed-point sweep and g_k = G(x_k) after it, the
+ * accelerated iterate is
+ *
+ * x_{k+1} = g_k - ΔG γ - (1 - β) (f_k - ΔF γ),
+ *
+ * where f_k = g_k - x_k, ΔF and ΔG hold the differences of the last m residuals and
+ * sweeps, γ minimizes ‖f_k - ΔF γ‖, and β is the mixing parameter. As a safeguard the
+ * history is discarded whenever the fixed-point residual grows, which falls back to a
+ * damped fixed-point step.
+ */
+template <typename number>
+class AndersonAcceleration
+{
+public:
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<number>;
+
+  /**
+   * @brief Constructor.
+   */
+  AndersonAcceleration(unsigned int _depth, number _mixing);
+
+  /**
+   * @brief Clear the history. This should be called at the start of each nonlinear
+   * solve and after remeshing.
+   */
+  void
+  clear();
+
+  /**
+   * @brief Apply a single acceleration step.
+   *
+   * @param[in] old_iterate The stacked vectors before the fixed-point sweep.
+   * @param[in,out] iterate The stacked vectors after the fixed-point sweep. On return,
+   * this holds the accelerated iterate.
+   */
+  void
+  apply(const std::vector<VectorType> &old_iterate, const std::vector<VectorType *> &iterate);
+
+  /**
+   * @brief Get the l2-norm of the fixed-point residual of the last step.
+   */
+  [[nodiscard]] number
+  get_residual_l2_norm() const
+  {
+    return residual_norm;
+  }
+
+  /**
+   * @brief Get the number of previous iterates in the history.
+   */
+  [[nodiscard]] unsigned int
+  get_history_size() const
+  {
+    return static_cast<unsigned int>(delta_residual.size());
+  }
+
+private:
+  /**
+   * @brief Dot product of two sets of stacked vectors.
+   */
+  [[nodiscard]] static number
+  stacked_dot(const std::vector<VectorType> &vector_1,
+              const std::vector<VectorType> &vector_2);
+
+  /**
+   * @brief Max number of previous iterates used in the acceleration.
+   */
+  unsigned int depth;
+
+  /**
+   * @brief Mixing parameter.
+   */
+  number mixing;
+
+  /**
+   * @brief l2-norm of the fixed-point residual of the last step.
+   */
+  number residual_norm = 0.0;
+
+  /**
+   * @brief Differences of successive fixed-point residuals.
+   */
+  std::deque<std::vector<VectorType>> delta_residual;
+
+  /**
+   * @brief Differences of successive fixed-point sweeps.
+   */
+  std::deque<std::vector<VectorType>> delta_iterate;
+
+  /**
+   * @brief Fixed-point residual of the previous step.
+   */
+  std::vector<VectorType> previous_residual;
+
+  /**
+   * @brief Fixed-point sweep of the previous step.
+   */
+  std::vector<VectorType> previous_iterate;
+};
+
+PRISMS_PF_END_NAMESPACE
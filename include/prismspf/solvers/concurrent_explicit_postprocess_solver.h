@@ -9,6 +9,9 @@
 
 #include <prismspf/config.h>
 
+#include <map>
+#include <string>
+
 PRISMS_PF_BEGIN_NAMESPACE
 
 template <unsigned int dim, unsigned int degree, typename number>
@@ -88,6 +91,13 @@ public:
    */
   void
   print() override;
+
+  /**
+   * @brief Get the reductions that were accumulated in the last solve, combined across
+   * all processes.
+   */
+  [[nodiscard]] std::map<std::string, double>
+  get_reductions();
 };
 
 PRISMS_PF_END_NAMESPACE
@@ -136,6 +136,75 @@ public:
     return newton_update->l2_norm();
   };
 
+  /**
+   * @brief Get the l2-norm of the residual computed at the start of the last solve.
+   */
+  [[nodiscard]] number
+  get_residual_l2_norm() const
+  {
+    return residual_norm;
+  };
+
+  /**
+   * @brief Get the l2-norm of the residual after the last solution update. This is only
+   * computed when the nonlinear solve needs it for the line search or the convergence
+   * criterion.
+   */
+  [[nodiscard]] number
+  get_updated_residual_l2_norm() const
+  {
+    return updated_residual_norm;
+  };
+
+  /**
+   * @brief Get the l2-norm of the residual at the start of the current nonlinear solve.
+   */
+  [[nodiscard]] number
+  get_initial_residual_l2_norm() const
+  {
+    return initial_residual_norm;
+  };
+
+  /**
+   * @brief Reset the history of the nonlinear solve. This should be called at the start
+   * of each nonlinear solve so the first Newton iteration uses the initial forcing term
+   * and records the initial residual.
+   */
+  void
+  reset_nonlinear_history()
+  {
+    first_newton_iteration = true;
+    forcing_term           = 0.0;
+    old_residual_norm      = 0.0;
+    initial_residual_norm  = 0.0;
+    updated_residual_norm  = 0.0;
+  };
+
+  /**
+   * @brief Compute the nonlinear residual at the current solution. This is the b in
+   * Ax=b.
+   */
+  void
+  compute_residual(VectorType &dst) const;
+
+  /**
+   * @brief Update the preconditioner of the newton update operator at the current
+   * solution. This must be called before apply_preconditioner() whenever the solution
+   * has changed.
+   */
+  virtual void
+  update_preconditioner() {};
+
+  /**
+   * @brief Apply the preconditioner of the newton update operator. By default this is the
+   * identity.
+   */
+  virtual void
+  apply_preconditioner(VectorType &dst, const VectorType &src) const
+  {
+    dst = src;
+  };
+
 protected:
   /**
    * @brief Compute the solver tolerance based on the specified tolerance type.
@@ -143,6 +212,17 @@ protected:
   void
   compute_solver_tolerance();
 
+  /**
+   * @brief Update the solution with the newton update scaled by the step length and apply
+   * constraints.
+   *
+   * For nonlinear solves with backtracking line search, the step length is reduced by
+   * the step size modifier until the residual norm decreases sufficiently or the max
+   * number of backtracks is reached.
+   */
+  void
+  update_solution(const number &step_length);
+
   /**
    * @brief Clear the system matrix and update system matrix.
    */
@@ -475,6 +555,46 @@ private:
    * @brief Solver tolerance
    */
   number tolerance = 0.0;
+
+  /**
+   * @brief Residual l2-norm at the start of the last solve.
+   */
+  number residual_norm = 0.0;
+
+  /**
+   * @brief Residual l2-norm after the last solution update.
+   */
+  number updated_residual_norm = 0.0;
+
+  /**
+   * @brief Residual l2-norm at the start of the current nonlinear solve.
+   */
+  number initial_residual_norm = 0.0;
+
+  /**
+   * @brief Whether the field is solved as part of a nonlinear solve.
+   */
+  bool is_nonlinear = false;
+
+  /**
+   * @brief Whether the next solve is the first Newton iteration of a nonlinear solve.
+   */
+  bool first_newton_iteration = true;
+
+  /**
+   * @brief Whether the solver tolerance is set by Eisenstat-Walker forcing terms.
+   */
+  bool use_forcing_term = false;
+
+  /**
+   * @brief Eisenstat-Walker forcing term of the last solve.
+   */
+  number forcing_term = 0.0;
+
+  /**
+   * @brief Residual l2-norm at the start of the previous Newton iteration.
+   */
+  number old_residual_norm = 0.0;
 };
 
 PRISMS_PF_END_NAMESPACE
@@ -23,6 +23,8 @@
 
 #include <prismspf/config.h>
 
+#include <memory>
+
 PRISMS_PF_BEGIN_NAMESPACE
 
 template <unsigned int dim, unsigned int degree, typename number>
@@ -39,6 +41,13 @@ public:
   using LevelMatrixType  = MatrixFreeOperator<dim, degree, float>;
   using VectorType       = dealii::LinearAlgebra::distributed::Vector<number>;
   using MGVectorType     = dealii::LinearAlgebra::distributed::Vector<float>;
+  using SmootherType     = dealii::PreconditionChebyshev<LevelMatrixType, MGVectorType>;
+  using MGSmootherType =
+    dealii::MGSmootherPrecondition<LevelMatrixType, SmootherType, MGVectorType>;
+  using PreconditionerType =
+    dealii::PreconditionMG<dim,
+                           MGVectorType,
+                           dealii::MGTransferGlobalCoarsening<dim, MGVectorType>>;
 
   /**
    * @brief Constructor.
@@ -99,6 +108,19 @@ public:
   void
   solve(const number &step_length = 1.0) override;
 
+  /**
+   * @brief Interpolate the solution to the multigrid levels and rebuild the smoothers and
+   * the multigrid preconditioner.
+   */
+  void
+  update_preconditioner() override;
+
+  /**
+   * @brief Apply a single V-cycle of the multigrid preconditioner.
+   */
+  void
+  apply_preconditioner(VectorType &dst, const VectorType &src) const override;
+
 private:
   /**
    * @brief Minimum multigrid level
@@ -143,6 +165,26 @@ private:
    */
   std::vector<std::shared_ptr<dealii::MGTransferGlobalCoarsening<dim, MGVectorType>>>
     mg_transfer;
+
+  /**
+   * @brief Chebyshev smoother for each multigrid level.
+   */
+  std::unique_ptr<MGSmootherType> mg_smoother;
+
+  /**
+   * @brief Coarse grid solver.
+   */
+  std::unique_ptr<dealii::MGCoarseGridApplySmoother<MGVectorType>> mg_coarse;
+
+  /**
+   * @brief Multigrid object.
+   */
+  std::unique_ptr<dealii::Multigrid<MGVectorType>> multigrid;
+
+  /**
+   * @brief Multigrid preconditioner.
+   */
+  std::unique_ptr<PreconditionerType> preconditioner;
 };
 
 PRISMS_PF_END_NAMESPACE
@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#pragma once
+
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <prismspf/core/types.h>
+
+#include <prismspf/solvers/sequential_solver.h>
+
+#include <prismspf/config.h>
+
+#include <vector>
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+template <unsigned int dim, unsigned int degree, typename number>
+class SolverContext;
+
+/**
+ * @brief This class handles the co-nonlinear solves of several nonexplicit fields as one
+ * block system.
+ *
+ * Each Newton iteration solves J δx = r for all implicit fields at once with GMRES. The
+ * action of the block Jacobian, including the off-diagonal couplings between fields, is
+ * computed matrix-free with a directional difference of the coupled residuals
+ *
+ * J v ≈ -(r(x + ε v) - r(x)) / ε,
+ *
+ * where the nonexplicit auxiliary fields are reevaluated for each residual. Each GMRES
+ * iteration then costs one coupled residual and one ghost update of the perturbed block
+ * fields, without assembling the off-diagonal blocks. The system is preconditioned
+ * block-diagonally with the linear solver of each field, so a GMG preconditioner applies
+ * a V-cycle of the user-defined LHS to its block.
+ */
+template <unsigned int dim, unsigned int degree, typename number>
+class MonolithicCoNonlinearSolver : public SequentialSolver<dim, degree, number>
+{
+public:
+  using VectorType      = dealii::LinearAlgebra::distributed::Vector<number>;
+  using BlockVectorType = dealii::LinearAlgebra::distributed::BlockVector<number>;
+
+  /**
+   * @brief Constructor.
+   */
+  explicit MonolithicCoNonlinearSolver(
+    const SolverContext<dim, degree, number> &_solver_context,
+    Types::Index                              _solve_priority = 0);
+
+  /**
+   * @brief Destructor.
+   */
+  ~MonolithicCoNonlinearSolver() override = default;
+
+  /**
+   * @brief Copy constructor.
+   *
+   * Deleted so solver instances aren't copied.
+   */
+  MonolithicCoNonlinearSolver(const MonolithicCoNonlinearSolver &solver_base) = delete;
+
+  /**
+   * @brief Copy assignment.
+   *
+   * Deleted so solver instances aren't copied.
+   */
+  MonolithicCoNonlinearSolver &
+  operator=(const MonolithicCoNonlinearSolver &solver_base) = delete;
+
+  /**
+   * @brief Move constructor.
+   *
+   * Deleted so solver instances aren't moved.
+   */
+  MonolithicCoNonlinearSolver(MonolithicCoNonlinearSolver &&solver_base) noexcept =
+    delete;
+
+  /**
+   * @brief Move assignment.
+   *
+   * Deleted so solver instances aren't moved.
+   */
+  MonolithicCoNonlinearSolver &
+  operator=(MonolithicCoNonlinearSolver &&solver_base) noexcept = delete;
+
+  /**
+   * @brief Initialize the solver.
+   */
+  void
+  init() override;
+
+  /**
+   * @brief Reinitialize the solver.
+   */
+  void
+  reinit() override;
+
+  /**
+   * @brief Solve for a single update step.
+   */
+  void
+  solve() override;
+
+  /**
+   * @brief Print information about the solver to summary.log.
+   */
+  void
+  print() override;
+
+private:
+  /**
+   * @brief Reinitialize a block vector with one block per field in the block system.
+   */
+  void
+  reinit_block_vector(BlockVectorType &vector) const;
+
+  /**
+   * @brief Reevaluate the auxiliary fields and compute the residual of the block system
+   * at the current solution.
+   */
+  void
+  compute_residual(BlockVectorType &dst);
+
+  /**
+   * @brief Update the ghost values of the solutions of the fields in the block system.
+   */
+  void
+  update_block_ghosts() const;
+
+  /**
+   * @brief Apply the block Jacobian at the linearization point to a vector.
+   */
+  void
+  apply_jacobian(BlockVectorType &dst, const BlockVectorType &src);
+
+  /**
+   * @brief Apply the block-diagonal preconditioner to a vector.
+   */
+  void
+  apply_preconditioner(BlockVectorType &dst, const BlockVectorType &src);
+
+  /**
+   * @brief Global indices of the fields in the block system.
+   */
+  std::vector<Types::Index> block_fields;
+
+  /**
+   * @brief Solution at the linearization point of the current Newton iteration.
+   */
+  std::vector<VectorType> linearization_point;
+
+  /**
+   * @brief l2-norm of the linearization point, which scales the differencing step.
+   */
+  double linearization_point_norm = 0.0;
+
+  /**
+   * @brief Solution at the perturbed linearization point.
+   */
+  std::vector<VectorType> perturbed_solution;
+
+  /**
+   * @brief Residual of the block system.
+   */
+  BlockVectorType residual;
+
+  /**
+   * @brief Residual of the block system at a perturbed solution.
+   */
+  BlockVectorType perturbed_residual;
+
+  /**
+   * @brief Newton update of the block system.
+   */
+  BlockVectorType newton_update;
+};
+
+PRISMS_PF_END_NAMESPACE
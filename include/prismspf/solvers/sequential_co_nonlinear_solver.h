@@ -5,10 +5,13 @@
 
 #include <prismspf/core/types.h>
 
+#include <prismspf/solvers/anderson_acceleration.h>
 #include <prismspf/solvers/sequential_solver.h>
 
 #include <prismspf/config.h>
 
+#include <memory>
+
 PRISMS_PF_BEGIN_NAMESPACE
 
 template <unsigned int dim, unsigned int degree, typename number>
@@ -87,6 +90,13 @@ public:
    */
   void
   print() override;
+
+private:
+  /**
+   * @brief Anderson acceleration of the block iteration. This is only allocated when the
+   * user specifies a nonzero depth.
+   */
+  std::unique_ptr<AndersonAcceleration<number>> anderson_acceleration;
 };
 
 PRISMS_PF_END_NAMESPACE
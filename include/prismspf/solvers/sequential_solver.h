@@ -25,6 +25,9 @@ class GMGSolver;
 template <unsigned int dim, unsigned int degree, typename number>
 class IdentitySolver;
 
+template <unsigned int dim, unsigned int degree, typename number>
+class LinearSolverBase;
+
 struct VariableAttributes;
 
 template <unsigned int dim, unsigned int degree, typename number>
@@ -137,6 +140,16 @@ public:
   void
   solve_explicit_solver(const VariableAttributes &variable);
 
+  /**
+   * @brief Evaluate the explicit solver objects of a given VariableAttributes at the
+   * current solution without updating the old solutions of the field. This is used by
+   * nonlinear solvers that evaluate auxiliary fields several times per increment.
+   *
+   * @param[in] variable The VariableAttributes
+   */
+  void
+  evaluate_explicit_solver(const VariableAttributes &variable);
+
   /**
    * @brief Solve the linear solver objects of a given VariableAttributes.
    *
@@ -159,6 +172,26 @@ public:
   number
   solve_linear_solver(const VariableAttributes &variable, const number &step_length);
 
+  /**
+   * @brief Check the convergence of the nonlinear solve of a given VariableAttributes
+   * with the tolerance type and value from the nonlinear solver parameters. Auxiliary
+   * fields are always considered converged.
+   *
+   * @param[in] variable The VariableAttributes
+   * @param[in] newton_update_norm The l2-norm of the newton update
+   */
+  [[nodiscard]] bool
+  is_nonlinear_solve_converged(const VariableAttributes &variable,
+                               const number             &newton_update_norm);
+
+  /**
+   * @brief Get the linear solver of a given field index.
+   *
+   * @param[in] global_field_index The global field index
+   */
+  [[nodiscard]] LinearSolverBase<dim, degree, number> &
+  get_linear_solver(Types::Index global_field_index);
+
   /**
    * @brief Get the matrix-free operator for the residual side.
    */
@@ -30,6 +30,15 @@ public:
   [[nodiscard]] bool
   should_checkpoint(unsigned int increment) const;
 
+  /**
+   * @brief Return if any increment is checkpointed.
+   */
+  [[nodiscard]] bool
+  has_checkpoints() const
+  {
+    return !checkpoint_list.empty();
+  }
+
   /**
    * @brief Postprocess and validate parameters.
    */
@@ -42,6 +51,15 @@ public:
   void
   print_parameter_summary() const;
 
+  /**
+   * @brief Get whether to load from a checkpoint.
+   */
+  [[nodiscard]] bool
+  get_load_from_checkpoint() const
+  {
+    return load_from_checkpoint;
+  }
+
   /**
    * @brief Set whether to load from a checkpoint.
    */
@@ -78,6 +96,99 @@ public:
     user_checkpoint_list = _user_checkpoint_list;
   }
 
+  /**
+   * @brief Get the directory on fast storage where the checkpoints are written first.
+   */
+  [[nodiscard]] const std::string &
+  get_fast_directory() const
+  {
+    return fast_directory;
+  }
+
+  /**
+   * @brief Set the directory on fast storage where the checkpoints are written first.
+   */
+  void
+  set_fast_directory(const std::string &_fast_directory)
+  {
+    fast_directory = _fast_directory;
+  }
+
+  /**
+   * @brief Whether the checkpoints are written to fast storage first.
+   */
+  [[nodiscard]] bool
+  has_fast_directory() const
+  {
+    return !fast_directory.empty();
+  }
+
+  /**
+   * @brief Get the number of checkpoints between copies to the working directory.
+   */
+  [[nodiscard]] unsigned int
+  get_flush_period() const
+  {
+    return flush_period;
+  }
+
+  /**
+   * @brief Set the number of checkpoints between copies to the working directory.
+   */
+  void
+  set_flush_period(unsigned int _flush_period)
+  {
+    flush_period = _flush_period;
+  }
+
+  /**
+   * @brief Get the number of most recent checkpoints to keep. If 0, every checkpoint is
+   * kept.
+   */
+  [[nodiscard]] unsigned int
+  get_n_kept_checkpoints() const
+  {
+    return n_kept_checkpoints;
+  }
+
+  /**
+   * @brief Set the number of most recent checkpoints to keep.
+   */
+  void
+  set_n_kept_checkpoints(unsigned int _n_kept_checkpoints)
+  {
+    n_kept_checkpoints = _n_kept_checkpoints;
+  }
+
+  /**
+   * @brief Get the wall time, in seconds, after which the simulation writes a checkpoint
+   * and stops.
+   */
+  [[nodiscard]] double
+  get_max_wall_time() const
+  {
+    return max_wall_time;
+  }
+
+  /**
+   * @brief Set the wall time, in seconds, after which the simulation writes a checkpoint
+   * and stops.
+   */
+  void
+  set_max_wall_time(double _max_wall_time)
+  {
+    max_wall_time = _max_wall_time;
+  }
+
+  /**
+   * @brief Whether the wall time of the simulation is limited.
+   */
+  [[nodiscard]] bool
+  has_max_wall_time() const
+  {
+    return max_wall_time > 0.0;
+  }
+
 private:
   // Whether to load from a checkpoint
   bool load_from_checkpoint = false;
@@ -93,6 +204,18 @@ private:
 
   // List of increments for checkpoints
   std::set<unsigned int> checkpoint_list;
+
+  // Directory on fast storage where the checkpoints are written first
+  std::string fast_directory;
+
+  // Number of checkpoints between copies to the working directory
+  unsigned int flush_period = 1;
+
+  // Number of most recent checkpoints to keep
+  unsigned int n_kept_checkpoints = 0;
+
+  // Wall time in seconds after which to checkpoint and stop. If 0, there is no limit.
+  double max_wall_time = 0.0;
 };
 
 inline bool
@@ -187,8 +310,13 @@ CheckpointParameters::print_parameter_summary() const
     << "================================================\n"
     << "  Checkpoint Parameters\n"
     << "================================================\n"
+    << "Load from checkpoint: " << bool_to_string(load_from_checkpoint) << "\n"
     << "Checkpoint condition: " << condition << "\n"
-    << "Number of checkpoints: " << n_checkpoints << "\n";
+    << "Number of checkpoints: " << n_checkpoints << "\n"
+    << "Fast directory: " << fast_directory << "\n"
+    << "Flush period: " << flush_period << "\n"
+    << "Number of checkpoints to keep: " << n_kept_checkpoints << "\n"
+    << "Max wall time: " << max_wall_time << "\n";
 
   ConditionalOStreams::pout_summary() << "Checkpoint iteration list: ";
   for (const auto &iteration : checkpoint_list)
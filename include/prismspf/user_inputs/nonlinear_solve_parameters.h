@@ -7,8 +7,13 @@
 
 #include <prismspf/user_inputs/linear_solve_parameters.h>
 
+#include <prismspf/utilities/utilities.h>
+
 #include <prismspf/config.h>
 
+#include <algorithm>
+#include <cmath>
+
 PRISMS_PF_BEGIN_NAMESPACE
 
 /**
@@ -23,8 +28,141 @@ public:
   // Max number of iterations for the nonlinear solve
   unsigned int max_iterations = Defaults::iterations;
 
+  // Tolerance type for the nonlinear solve
+  SolverToleranceType tolerance_type = SolverToleranceType::AbsoluteSolutionChange;
+
   // Tolerance value for the nonlinear solve
   double tolerance_value = Defaults::tolerance;
+
+  // Whether to use a backtracking line search on the nonlinear residual norm
+  bool use_backtracking_line_search = false;
+
+  // The factor by which the step length decreases per backtrack. The 'tau' parameter.
+  double step_size_modifier = 0.5;
+
+  // The sufficient decrease constant for the residual norm. The 'c' parameter.
+  double residual_decrease_coefficient = 1.0e-4;
+
+  // Max number of backtracks per Newton iteration
+  unsigned int max_backtracks = 10;
+
+  // Whether to use Eisenstat-Walker forcing terms to set the linear solver tolerance
+  // of each Newton iteration. When enabled, this overrides the tolerance type and value
+  // in the linear solver parameters.
+  bool use_eisenstat_walker = false;
+
+  // Forcing term used for the first Newton iteration
+  double initial_forcing_term = 0.5;
+
+  // Upper bound for the forcing term
+  double max_forcing_term = 0.9;
+
+  // The 'gamma' parameter of the Eisenstat-Walker forcing term
+  double forcing_term_gamma = 0.9;
+
+  // The 'alpha' parameter of the Eisenstat-Walker forcing term
+  double forcing_term_alpha = 0.5 * (1.0 + std::sqrt(5.0));
+
+  /**
+   * @brief Whether the nonlinear residual norm must be computed after each Newton update,
+   * either for the line search or for the convergence criterion.
+   */
+  [[nodiscard]] bool
+  requires_updated_residual() const
+  {
+    return use_backtracking_line_search ||
+           tolerance_type != SolverToleranceType::AbsoluteSolutionChange;
+  }
+
+  /**
+   * @brief Whether a backtracked step length gives a sufficient decrease of the residual
+   * norm, ‖F(x + λ δx)‖ ≤ (1 - c λ) ‖F(x)‖.
+   */
+  [[nodiscard]] bool
+  is_sufficient_decrease(double step_length,
+                         double new_residual_norm,
+                         double residual_norm) const
+  {
+    return new_residual_norm <=
+           (1.0 - (residual_decrease_coefficient * step_length)) * residual_norm;
+  }
+
+  /**
+   * @brief Whether the step length and backtracking line search are the same as those
+   * of another field.
+   */
+  [[nodiscard]] bool
+  has_same_line_search(const NonlinearSolverParameters &other) const
+  {
+    if (step_length != other.step_length ||
+        use_backtracking_line_search != other.use_backtracking_line_search)
+      {
+        return false;
+      }
+    return !use_backtracking_line_search ||
+           (step_size_modifier == other.step_size_modifier &&
+            residual_decrease_coefficient == other.residual_decrease_coefficient &&
+            max_backtracks == other.max_backtracks);
+  }
+
+  /**
+   * @brief Check the convergence of the nonlinear solve.
+   *
+   * @param[in] newton_update_norm The l2-norm of the Newton update.
+   * @param[in] residual_norm The residual l2-norm after the Newton update.
+   * @param[in] initial_residual_norm The residual l2-norm before the first Newton
+   * iteration.
+   */
+  [[nodiscard]] bool
+  is_converged(double newton_update_norm,
+               double residual_norm,
+               double initial_residual_norm) const
+  {
+    switch (tolerance_type)
+      {
+        case SolverToleranceType::AbsoluteResidual:
+          return residual_norm <= tolerance_value;
+        case SolverToleranceType::RelativeResidualChange:
+          return residual_norm <= tolerance_value * initial_residual_norm;
+        case SolverToleranceType::AbsoluteSolutionChange:
+        default:
+          return newton_update_norm <= tolerance_value;
+      }
+  }
+
+  /**
+   * @brief Compute the next Eisenstat-Walker forcing term.
+   *
+   * This uses choice 2 from Eisenstat and Walker (1996), η_k = γ (‖F_k‖ / ‖F_{k-1}‖)^α,
+   * with the safeguard that prevents the forcing term from decreasing too quickly when
+   * γ η_{k-1}^α > 0.1. The result is capped by the maximum forcing term.
+   *
+   * @param[in] residual_norm The nonlinear residual norm of the current iteration.
+   * @param[in] old_residual_norm The nonlinear residual norm of the previous iteration.
+   * @param[in] old_forcing_term The forcing term of the previous iteration.
+   */
+  [[nodiscard]] double
+  compute_forcing_term(double residual_norm,
+                       double old_residual_norm,
+                       double old_forcing_term) const
+  {
+    if (old_residual_norm <= 0.0)
+      {
+        return initial_forcing_term;
+      }
+
+    double forcing_term = forcing_term_gamma *
+                          std::pow(residual_norm / old_residual_norm, forcing_term_alpha);
+
+    const double safeguard =
+      forcing_term_gamma * std::pow(old_forcing_term, forcing_term_alpha);
+    if (safeguard > 0.1)
+      {
+        forcing_term = std::max(forcing_term, safeguard);
+      }
+
+    return std::min(forcing_term, max_forcing_term);
+  }
 };
 
 /**
@@ -73,9 +211,110 @@ public:
     return nonlinear_solve.at(index);
   }
 
+  /**
+   * @brief Set the Anderson acceleration parameters for the co-nonlinear block
+   * iteration.
+   */
+  void
+  set_anderson_acceleration_parameters(unsigned int depth, double mixing)
+  {
+    anderson_depth  = depth;
+    anderson_mixing = mixing;
+  }
+
+  /**
+   * @brief Get the Anderson acceleration depth. A depth of zero disables the
+   * acceleration.
+   */
+  [[nodiscard]] unsigned int
+  get_anderson_depth() const
+  {
+    return anderson_depth;
+  }
+
+  /**
+   * @brief Get the Anderson mixing parameter.
+   */
+  [[nodiscard]] double
+  get_anderson_mixing() const
+  {
+    return anderson_mixing;
+  }
+
+  /**
+   * @brief Set the parameters of the monolithic co-nonlinear solve.
+   */
+  void
+  set_monolithic_parameters(bool         use_monolithic,
+                            double       linear_tolerance,
+                            unsigned int linear_max_iterations,
+                            unsigned int linear_restart_length)
+  {
+    use_monolithic_solve         = use_monolithic;
+    monolithic_linear_tolerance  = linear_tolerance;
+    monolithic_linear_iterations = linear_max_iterations;
+    monolithic_linear_restart    = linear_restart_length;
+  }
+
+  /**
+   * @brief Whether the co-nonlinear fields are solved as one block system instead of
+   * field by field.
+   */
+  [[nodiscard]] bool
+  get_use_monolithic_solve() const
+  {
+    return use_monolithic_solve;
+  }
+
+  /**
+   * @brief Get the relative tolerance of the Krylov solve of the monolithic system.
+   */
+  [[nodiscard]] double
+  get_monolithic_linear_tolerance() const
+  {
+    return monolithic_linear_tolerance;
+  }
+
+  /**
+   * @brief Get the max number of Krylov iterations of the monolithic system.
+   */
+  [[nodiscard]] unsigned int
+  get_monolithic_linear_iterations() const
+  {
+    return monolithic_linear_iterations;
+  }
+
+  /**
+   * @brief Get the number of GMRES iterations between restarts of the monolithic system.
+   */
+  [[nodiscard]] unsigned int
+  get_monolithic_linear_restart() const
+  {
+    return monolithic_linear_restart;
+  }
+
 private:
   // Map of nonlinear solve parameters for fields that require them
   std::map<Types::Index, NonlinearSolverParameters> nonlinear_solve;
+
+  // Number of previous iterates used by the Anderson acceleration of the co-nonlinear
+  // block iteration
+  unsigned int anderson_depth = 0;
+
+  // Mixing parameter of the Anderson acceleration. The 'beta' parameter.
+  double anderson_mixing = 1.0;
+
+  // Whether to solve the co-nonlinear fields as one block system
+  bool use_monolithic_solve = false;
+
+  // Relative tolerance of the Krylov solve of the monolithic system
+  double monolithic_linear_tolerance = 1.0e-6;
+
+  // Max number of Krylov iterations of the monolithic system
+  unsigned int monolithic_linear_iterations = 200;
+
+  // Number of GMRES iterations between restarts of the monolithic system
+  unsigned int monolithic_linear_restart = 50;
 };
 
 inline void
@@ -91,7 +330,56 @@ NonlinearSolveParameterSet::postprocess_and_validate()
 
       AssertThrow(nonlinear_solver_parameters.tolerance_value > 0,
                   dealii::ExcMessage("Tolerance must be greater than 0.0"));
+
+      if (nonlinear_solver_parameters.use_backtracking_line_search)
+        {
+          AssertThrow(nonlinear_solver_parameters.step_size_modifier > 0.0 &&
+                        nonlinear_solver_parameters.step_size_modifier < 1.0,
+                      dealii::ExcMessage("Step size modifier must be greater than 0.0 "
+                                         "and less than 1.0"));
+
+          AssertThrow(nonlinear_solver_parameters.residual_decrease_coefficient > 0.0 &&
+                        nonlinear_solver_parameters.residual_decrease_coefficient < 1.0,
+                      dealii::ExcMessage("Residual decrease coefficient must be greater "
+                                         "than 0.0 and less than 1.0"));
+        }
+
+      if (nonlinear_solver_parameters.use_eisenstat_walker)
+        {
+          AssertThrow(nonlinear_solver_parameters.initial_forcing_term > 0.0 &&
+                        nonlinear_solver_parameters.initial_forcing_term < 1.0,
+                      dealii::ExcMessage("Initial forcing term must be greater than 0.0 "
+                                         "and less than 1.0"));
+
+          AssertThrow(nonlinear_solver_parameters.max_forcing_term > 0.0 &&
+                        nonlinear_solver_parameters.max_forcing_term < 1.0,
+                      dealii::ExcMessage("Max forcing term must be greater than 0.0 and "
+                                         "less than 1.0"));
+
+          AssertThrow(nonlinear_solver_parameters.forcing_term_gamma > 0.0 &&
+                        nonlinear_solver_parameters.forcing_term_gamma <= 1.0,
+                      dealii::ExcMessage("Forcing term gamma must be greater than 0.0 "
+                                         "and less than or equal to 1.0"));
+
+          AssertThrow(nonlinear_solver_parameters.forcing_term_alpha > 1.0 &&
+                        nonlinear_solver_parameters.forcing_term_alpha <= 2.0,
+                      dealii::ExcMessage("Forcing term alpha must be greater than 1.0 "
+                                         "and less than or equal to 2.0"));
+        }
     }
+
+  AssertThrow(anderson_mixing > 0.0 && anderson_mixing <= 1.0,
+              dealii::ExcMessage("Anderson mixing parameter must be greater than 0.0 "
+                                 "and less than or equal to 1.0"));
+
+  AssertThrow(!use_monolithic_solve ||
+                (monolithic_linear_tolerance > 0.0 && monolithic_linear_tolerance < 1.0),
+              dealii::ExcMessage("Monolithic linear tolerance must be greater than 0.0 "
+                                 "and less than 1.0"));
+
+  AssertThrow(!use_monolithic_solve || monolithic_linear_restart > 0,
+              dealii::ExcMessage(
+                "Monolithic linear restart length must be greater than 0"));
 }
 
 inline void
@@ -109,7 +397,60 @@ NonlinearSolveParameterSet::print_parameter_summary() const
           ConditionalOStreams::pout_summary()
             << "Index: " << index << "\n"
             << "  Max iterations: " << nonlinear_solver_parameters.max_iterations << "\n"
-            << "  Step length: " << nonlinear_solver_parameters.step_length << "\n";
+            << "  Tolerance: " << nonlinear_solver_parameters.tolerance_value << "\n"
+            << "  Type: " << to_string(nonlinear_solver_parameters.tolerance_type) << "\n"
+            << "  Step length: " << nonlinear_solver_parameters.step_length << "\n"
+            << "  Backtracking line search: "
+            << bool_to_string(nonlinear_solver_parameters.use_backtracking_line_search)
+            << "\n";
+
+          if (nonlinear_solver_parameters.use_backtracking_line_search)
+            {
+              ConditionalOStreams::pout_summary()
+                << "  Step size modifier: "
+                << nonlinear_solver_parameters.step_size_modifier << "\n"
+                << "  Residual decrease coefficient: "
+                << nonlinear_solver_parameters.residual_decrease_coefficient << "\n"
+                << "  Max backtracks: " << nonlinear_solver_parameters.max_backtracks
+                << "\n";
+            }
+
+          ConditionalOStreams::pout_summary()
+            << "  Eisenstat-Walker forcing terms: "
+            << bool_to_string(nonlinear_solver_parameters.use_eisenstat_walker) << "\n";
+
+          if (nonlinear_solver_parameters.use_eisenstat_walker)
+            {
+              ConditionalOStreams::pout_summary()
+                << "  Initial forcing term: "
+                << nonlinear_solver_parameters.initial_forcing_term << "\n"
+                << "  Max forcing term: " << nonlinear_solver_parameters.max_forcing_term
+                << "\n"
+                << "  Forcing term gamma: "
+                << nonlinear_solver_parameters.forcing_term_gamma << "\n"
+                << "  Forcing term alpha: "
+                << nonlinear_solver_parameters.forcing_term_alpha << "\n";
+            }
+        }
+
+      ConditionalOStreams::pout_summary()
+        << "Anderson acceleration depth: " << anderson_depth << "\n";
+      if (anderson_depth > 0)
+        {
+          ConditionalOStreams::pout_summary()
+            << "Anderson mixing parameter: " << anderson_mixing << "\n";
+        }
+
+      ConditionalOStreams::pout_summary()
+        << "Monolithic co-nonlinear solve: " << bool_to_string(use_monolithic_solve)
+        << "\n";
+      if (use_monolithic_solve)
+        {
+          ConditionalOStreams::pout_summary()
+            << "Monolithic linear tolerance: " << monolithic_linear_tolerance << "\n"
+            << "Monolithic linear max iterations: " << monolithic_linear_iterations
+            << "\n"
+            << "Monolithic linear restart length: " << monolithic_linear_restart << "\n";
         }
 
       ConditionalOStreams::pout_summary() << "\n" << std::flush;
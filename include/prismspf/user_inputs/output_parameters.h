@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include <deal.II/base/data_out_base.h>
+
 #include <prismspf/core/conditional_ostreams.h>
 #include <prismspf/core/exceptions.h>
+#include <prismspf/core/variable_attributes.h>
 
 #include <prismspf/user_inputs/temporal_discretization.h>
 
@@ -13,8 +16,10 @@
 #include <prismspf/config.h>
 
 #include <climits>
+#include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 PRISMS_PF_BEGIN_NAMESPACE
 
@@ -30,11 +35,21 @@ public:
   [[nodiscard]] bool
   should_output(unsigned int increment) const;
 
+  /**
+   * @brief Return if the statistics of the increment should be appended to the
+   * time-series log.
+   */
+  [[nodiscard]] bool
+  should_log_statistics(unsigned int increment) const;
+
   /**
    * @brief Postprocess and validate parameters.
    */
   void
-  postprocess_and_validate(const TemporalDiscretization &temporal_discretization);
+  postprocess_and_validate(
+    const TemporalDiscretization                     &temporal_discretization,
+    unsigned int                                      dim,
+    const std::map<unsigned int, VariableAttributes> &var_attributes);
 
   /**
    * @brief Print parameters to summary.log
@@ -105,6 +120,197 @@ public:
     patch_subdivisions = _patch_subdivisions;
   }
 
+  /**
+   * @brief Get whether the cells are written as high-order Lagrange cells
+   */
+  [[nodiscard]] bool
+  get_write_higher_order_cells() const
+  {
+    return write_higher_order_cells;
+  }
+
+  /**
+   * @brief Set whether the cells are written as high-order Lagrange cells
+   */
+  void
+  set_write_higher_order_cells(const bool &_write_higher_order_cells)
+  {
+    write_higher_order_cells = _write_higher_order_cells;
+  }
+
+  /**
+   * @brief Get the compression level
+   */
+  [[nodiscard]] dealii::DataOutBase::CompressionLevel
+  get_compression_level() const
+  {
+    return compression_level;
+  }
+
+  /**
+   * @brief Set the compression level
+   */
+  void
+  set_compression_level(const dealii::DataOutBase::CompressionLevel &_compression_level)
+  {
+    compression_level = _compression_level;
+  }
+
+  /**
+   * @brief Get whether the output is written on a background thread
+   */
+  [[nodiscard]] bool
+  get_asynchronous_output() const
+  {
+    return asynchronous_output;
+  }
+
+  /**
+   * @brief Set whether the output is written on a background thread
+   */
+  void
+  set_asynchronous_output(const bool &_asynchronous_output)
+  {
+    asynchronous_output = _asynchronous_output;
+  }
+
+  /**
+   * @brief Get the number of solution buffers for asynchronous output
+   */
+  [[nodiscard]] unsigned int
+  get_n_buffers() const
+  {
+    return n_buffers;
+  }
+
+  /**
+   * @brief Set the number of solution buffers for asynchronous output
+   */
+  void
+  set_n_buffers(const unsigned int &_n_buffers)
+  {
+    n_buffers = _n_buffers;
+  }
+
+  /**
+   * @brief Whether a field is written to the solution output.
+   */
+  [[nodiscard]] bool
+  should_output_field(const VariableAttributes &variable) const
+  {
+    return variable.is_output() && (!postprocessed_only || variable.is_postprocess());
+  }
+
+  /**
+   * @brief Set whether only the postprocessed fields are written
+   */
+  void
+  set_postprocessed_only(const bool &_postprocessed_only)
+  {
+    postprocessed_only = _postprocessed_only;
+  }
+
+  /**
+   * @brief Whether the isosurfaces of any field are written
+   */
+  [[nodiscard]] bool
+  has_isosurfaces() const
+  {
+    return !isosurface_fields.empty();
+  }
+
+  /**
+   * @brief Get the fields whose isosurfaces are written
+   */
+  [[nodiscard]] const std::vector<std::string> &
+  get_isosurface_fields() const
+  {
+    return isosurface_fields;
+  }
+
+  /**
+   * @brief Set the fields whose isosurfaces are written
+   */
+  void
+  set_isosurface_fields(const std::vector<std::string> &_isosurface_fields)
+  {
+    isosurface_fields = _isosurface_fields;
+  }
+
+  /**
+   * @brief Get the values of the isosurfaces
+   */
+  [[nodiscard]] const std::vector<double> &
+  get_isosurface_values() const
+  {
+    return isosurface_values;
+  }
+
+  /**
+   * @brief Set the values of the isosurfaces
+   */
+  void
+  set_isosurface_values(const std::vector<double> &_isosurface_values)
+  {
+    isosurface_values = _isosurface_values;
+  }
+
+  /**
+   * @brief Get whether only the isosurfaces are written, without the full fields
+   */
+  [[nodiscard]] bool
+  get_isosurfaces_only() const
+  {
+    return isosurfaces_only;
+  }
+
+  /**
+   * @brief Set whether only the isosurfaces are written, without the full fields
+   */
+  void
+  set_isosurfaces_only(const bool &_isosurfaces_only)
+  {
+    isosurfaces_only = _isosurfaces_only;
+  }
+
+  /**
+   * @brief Whether the output is limited to a region of interest
+   */
+  [[nodiscard]] bool
+  has_output_region() const
+  {
+    return !region_lower_corner.empty();
+  }
+
+  /**
+   * @brief Get the lower corner of the region of interest
+   */
+  [[nodiscard]] const std::vector<double> &
+  get_region_lower_corner() const
+  {
+    return region_lower_corner;
+  }
+
+  /**
+   * @brief Get the upper corner of the region of interest
+   */
+  [[nodiscard]] const std::vector<double> &
+  get_region_upper_corner() const
+  {
+    return region_upper_corner;
+  }
+
+  /**
+   * @brief Set the corners of the region of interest
+   */
+  void
+  set_output_region(const std::vector<double> &_region_lower_corner,
+                    const std::vector<double> &_region_upper_corner)
+  {
+    region_lower_corner = _region_lower_corner;
+    region_upper_corner = _region_upper_corner;
+  }
+
   /**
    * @brief Set the output condition
    */
@@ -141,6 +347,61 @@ public:
     print_timing_with_output = _print_timing_with_output;
   }
 
+  /**
+   * @brief Whether the given statistic (integral, l2 norm, min, max, mean, phase
+   * fraction, or interface area) is computed.
+   */
+  [[nodiscard]] bool
+  has_statistic(const std::string &statistic) const
+  {
+    return statistics.contains(statistic);
+  }
+
+  /**
+   * @brief Set the statistics that are computed.
+   */
+  void
+  set_statistics(const std::vector<std::string> &_statistics)
+  {
+    statistics = std::set<std::string>(_statistics.begin(), _statistics.end());
+  }
+
+  /**
+   * @brief Get the number of increments between entries of the statistics log.
+   */
+  [[nodiscard]] unsigned int
+  get_statistics_period() const
+  {
+    return statistics_period;
+  }
+
+  /**
+   * @brief Set the number of increments between entries of the statistics log.
+   */
+  void
+  set_statistics_period(unsigned int _statistics_period)
+  {
+    statistics_period = _statistics_period;
+  }
+
+  /**
+   * @brief Get the value of a field above which a point belongs to the phase.
+   */
+  [[nodiscard]] double
+  get_phase_fraction_threshold() const
+  {
+    return phase_fraction_threshold;
+  }
+
+  /**
+   * @brief Set the value of a field above which a point belongs to the phase.
+   */
+  void
+  set_phase_fraction_threshold(double _phase_fraction_threshold)
+  {
+    phase_fraction_threshold = _phase_fraction_threshold;
+  }
+
 private:
   // Output file type
   std::string file_type;
@@ -155,6 +416,36 @@ private:
   // element degree.
   unsigned int patch_subdivisions = 0;
 
+  // Whether the cells are written as high-order Lagrange cells
+  bool write_higher_order_cells = false;
+
+  // The zlib compression level
+  dealii::DataOutBase::CompressionLevel compression_level =
+    dealii::DataOutBase::CompressionLevel::best_speed;
+
+  // Whether the output is written on a background thread
+  bool asynchronous_output = false;
+
+  // The number of solution buffers for asynchronous output. This bounds the number of
+  // outputs that can wait to be written.
+  unsigned int n_buffers = 2;
+
+  // Whether only the postprocessed fields are written
+  bool postprocessed_only = false;
+
+  // The fields whose isosurfaces are written
+  std::vector<std::string> isosurface_fields;
+
+  // The values of the isosurfaces
+  std::vector<double> isosurface_values;
+
+  // Whether only the isosurfaces are written, without the full fields
+  bool isosurfaces_only = false;
+
+  // The corners of the region of interest. If empty, the whole domain is written.
+  std::vector<double> region_lower_corner;
+  std::vector<double> region_upper_corner;
+
   // Output condition type
   std::string condition;
 
@@ -170,6 +461,16 @@ private:
 
   // List of increments that output the solution to file
   std::set<unsigned int> output_list;
+
+  // The statistics that are computed for each field
+  std::set<std::string> statistics;
+
+  // The number of increments between entries of the statistics log. If 0, the
+  // statistics are only printed with the output.
+  unsigned int statistics_period = 0;
+
+  // The value of a field above which a point belongs to the phase
+  double phase_fraction_threshold = 0.5;
 };
 
 inline bool
@@ -178,10 +479,88 @@ OutputParameters::should_output(unsigned int increment) const
   return output_list.contains(increment);
 }
 
+inline bool
+OutputParameters::should_log_statistics(unsigned int increment) const
+{
+  return statistics_period != 0 && increment % statistics_period == 0;
+}
+
 inline void
 OutputParameters::postprocess_and_validate(
-  const TemporalDiscretization &temporal_discretization)
+  const TemporalDiscretization                     &temporal_discretization,
+  unsigned int                                      dim,
+  const std::map<unsigned int, VariableAttributes> &var_attributes)
 {
+#ifndef PRISMS_PF_WITH_HDF5
+  AssertThrow(file_type != "hdf5",
+              dealii::ExcMessage("The hdf5 file type requires PRISMS-PF to be built with "
+                                 "HDF5."));
+#endif
+
+  // Check that the region of interest is valid
+  AssertThrow(region_lower_corner.empty() ||
+                (region_lower_corner.size() == dim && region_upper_corner.size() == dim),
+              dealii::ExcMessage("The corners of the output region must have one "
+                                 "coordinate per dimension."));
+  AssertThrow(region_lower_corner.size() == region_upper_corner.size(),
+              dealii::ExcMessage("The lower and upper corners of the output region must "
+                                 "have the same number of coordinates."));
+  for (unsigned int i = 0; i < region_lower_corner.size(); ++i)
+    {
+      AssertThrow(region_lower_corner[i] <= region_upper_corner[i],
+                  dealii::ExcMessage("The lower corner of the output region must be "
+                                     "below the upper corner."));
+    }
+
+  // Lagrange cells are only supported by the VTK formats
+  AssertThrow(!write_higher_order_cells || file_type != "hdf5",
+              dealii::ExcMessage(
+                "Higher order cells are not supported with the hdf5 file type."));
+
+  // The background thread can only write the file types that do not communicate
+  AssertThrow(!asynchronous_output || file_type == "pvtu" || file_type == "vtk",
+              dealii::ExcMessage(
+                "Asynchronous output requires the pvtu or vtk file type."));
+
+  // Isosurfaces can only be extracted from scalar fields
+  for (const auto &field : isosurface_fields)
+    {
+      bool found = false;
+      for (const auto &[index, variable] : var_attributes)
+        {
+          if (variable.get_name() == field)
+            {
+              AssertThrow(variable.get_field_type() == FieldType::Scalar,
+                          dealii::ExcMessage("The isosurface field " + field +
+                                             " must be a scalar field."));
+              found = true;
+            }
+        }
+      AssertThrow(found,
+                  dealii::ExcMessage("The isosurface field " + field +
+                                     " is not a field of the application."));
+    }
+  AssertThrow(isosurface_fields.empty() || !isosurface_values.empty(),
+              dealii::ExcMessage("At least one isosurface value must be given."));
+  AssertThrow(!isosurfaces_only || !isosurface_fields.empty(),
+              dealii::ExcMessage(
+                "Writing only the isosurfaces requires at least one isosurface field."));
+
+  // Check that the full output has at least one field to write
+  if (!isosurfaces_only)
+    {
+      bool has_output_field = false;
+      for (const auto &[index, variable] : var_attributes)
+        {
+          has_output_field = has_output_field || should_output_field(variable);
+        }
+      AssertThrow(has_output_field,
+                  dealii::ExcMessage(
+                    "No field is written to the output. Either a field must be an "
+                    "output field, and postprocessed if only the postprocessed fields "
+                    "are written, or only the isosurfaces must be written."));
+    }
+
   // If the user has specified a list and we have list output use that and return early
   if (condition == "LIST")
     {
@@ -267,10 +646,54 @@ OutputParameters::print_parameter_summary() const
     << "Output file type: " << file_type << "\n"
     << "Output file name: " << file_name << "\n"
     << "Output subdivisions: " << patch_subdivisions << "\n"
+    << "Higher order cells: " << bool_to_string(write_higher_order_cells) << "\n"
+    << "Asynchronous output: " << bool_to_string(asynchronous_output) << "\n"
+    << "Output buffers: " << n_buffers << "\n"
+    << "Postprocessed fields only: " << bool_to_string(postprocessed_only) << "\n"
     << "Print output period: " << print_output_period << "\n"
     << "Output condition: " << condition << "\n"
     << "Number of outputs: " << n_outputs << "\n"
-    << "Print timing info: " << bool_to_string(print_timing_with_output) << "\n";
+    << "Print timing info: " << bool_to_string(print_timing_with_output) << "\n"
+    << "Statistics log period: " << statistics_period << "\n";
+
+  ConditionalOStreams::pout_summary() << "Statistics: ";
+  for (const auto &statistic : statistics)
+    {
+      ConditionalOStreams::pout_summary() << statistic << " ";
+    }
+  ConditionalOStreams::pout_summary() << "\n";
+  if (has_statistic("phase fraction"))
+    {
+      ConditionalOStreams::pout_summary()
+        << "Phase fraction threshold: " << phase_fraction_threshold << "\n";
+    }
+
+  if (has_isosurfaces())
+    {
+      ConditionalOStreams::pout_summary() << "Isosurface fields: ";
+      for (const auto &field : isosurface_fields)
+        {
+          ConditionalOStreams::pout_summary() << field << " ";
+        }
+      ConditionalOStreams::pout_summary() << "\nIsosurface values: ";
+      for (const auto &value : isosurface_values)
+        {
+          ConditionalOStreams::pout_summary() << value << " ";
+        }
+      ConditionalOStreams::pout_summary()
+        << "\nIsosurfaces only: " << bool_to_string(isosurfaces_only) << "\n";
+    }
+
+  if (has_output_region())
+    {
+      ConditionalOStreams::pout_summary() << "Output region: ";
+      for (unsigned int i = 0; i < region_lower_corner.size(); ++i)
+        {
+          ConditionalOStreams::pout_summary()
+            << "[" << region_lower_corner[i] << ", " << region_upper_corner[i] << "] ";
+        }
+      ConditionalOStreams::pout_summary() << "\n";
+    }
 
   ConditionalOStreams::pout_summary() << "Output iteration list: ";
   for (const auto &iteration : output_list)
@@ -445,6 +445,17 @@ public:
     return increment % remeshing_period == 0;
   }
 
+  /**
+   * @brief Whether the refinement criteria are checked to trigger remeshing on the
+   * provided increment.
+   */
+  [[nodiscard]] bool
+  should_check_remeshing_event(unsigned int increment) const
+  {
+    return has_adaptivity && remeshing_trigger == GridRefinement::Event &&
+           !should_refine_mesh(increment);
+  }
+
   /**
    * @brief Get the domain extents in each cartesian direction
    */
@@ -607,6 +618,152 @@ public:
     remeshing_period = _remeshing_period;
   }
 
+  /**
+   * @brief Get the event that triggers remeshing
+   */
+  [[nodiscard]] GridRefinement::RemeshingTrigger
+  get_remeshing_trigger() const
+  {
+    return remeshing_trigger;
+  }
+
+  /**
+   * @brief Set the event that triggers remeshing
+   */
+  void
+  set_remeshing_trigger(const GridRefinement::RemeshingTrigger &_remeshing_trigger)
+  {
+    remeshing_trigger = _remeshing_trigger;
+  }
+
+  /**
+   * @brief Get the number of neighbor layers that are refined around the cells that meet
+   * the refinement criteria
+   */
+  [[nodiscard]] unsigned int
+  get_refinement_buffer_layers() const
+  {
+    return refinement_buffer_layers;
+  }
+
+  /**
+   * @brief Set the number of neighbor layers that are refined around the cells that meet
+   * the refinement criteria
+   */
+  void
+  set_refinement_buffer_layers(const unsigned int &_refinement_buffer_layers)
+  {
+    refinement_buffer_layers = _refinement_buffer_layers;
+  }
+
+  /**
+   * @brief Get the strategy used to mark cells for refinement and coarsening
+   */
+  [[nodiscard]] GridRefinement::MarkingStrategy
+  get_marking_strategy() const
+  {
+    return marking_strategy;
+  }
+
+  /**
+   * @brief Set the strategy used to mark cells for refinement and coarsening
+   */
+  void
+  set_marking_strategy(const GridRefinement::MarkingStrategy &_marking_strategy)
+  {
+    marking_strategy = _marking_strategy;
+  }
+
+  /**
+   * @brief Get the fraction of cells (or error) to refine
+   */
+  [[nodiscard]] double
+  get_refine_fraction() const
+  {
+    return refine_fraction;
+  }
+
+  /**
+   * @brief Set the fraction of cells (or error) to refine
+   */
+  void
+  set_refine_fraction(const double &_refine_fraction)
+  {
+    refine_fraction = _refine_fraction;
+  }
+
+  /**
+   * @brief Get the fraction of cells (or error) to coarsen
+   */
+  [[nodiscard]] double
+  get_coarsen_fraction() const
+  {
+    return coarsen_fraction;
+  }
+
+  /**
+   * @brief Set the fraction of cells (or error) to coarsen
+   */
+  void
+  set_coarsen_fraction(const double &_coarsen_fraction)
+  {
+    coarsen_fraction = _coarsen_fraction;
+  }
+
+  /**
+   * @brief Get the maximum number of cells for fixed number marking
+   */
+  [[nodiscard]] unsigned int
+  get_max_number_of_cells() const
+  {
+    return max_number_of_cells;
+  }
+
+  /**
+   * @brief Set the maximum number of cells for fixed number marking
+   */
+  void
+  set_max_number_of_cells(const unsigned int &_max_number_of_cells)
+  {
+    max_number_of_cells = _max_number_of_cells;
+  }
+
+  /**
+   * @brief Get the source of the cell weights used to partition the mesh
+   */
+  [[nodiscard]] GridRefinement::CellWeighting
+  get_cell_weighting() const
+  {
+    return cell_weighting;
+  }
+
+  /**
+   * @brief Set the source of the cell weights used to partition the mesh
+   */
+  void
+  set_cell_weighting(const GridRefinement::CellWeighting &_cell_weighting)
+  {
+    cell_weighting = _cell_weighting;
+  }
+
+  /**
+   * @brief Get the load imbalance above which the mesh is repartitioned
+   */
+  [[nodiscard]] double
+  get_imbalance_threshold() const
+  {
+    return imbalance_threshold;
+  }
+
+  /**
+   * @brief Set the load imbalance above which the mesh is repartitioned
+   */
+  void
+  set_imbalance_threshold(const double &_imbalance_threshold)
+  {
+    imbalance_threshold = _imbalance_threshold;
+  }
+
   /**
    * @brief Get the refinement criteria
    */
@@ -657,8 +814,32 @@ private:
   // The number of steps between remeshing
   unsigned int remeshing_period = UINT_MAX;
 
+  // The event that triggers remeshing
+  GridRefinement::RemeshingTrigger remeshing_trigger = GridRefinement::Period;
+
+  // The number of neighbor layers refined around the cells that meet the criteria
+  unsigned int refinement_buffer_layers = 0;
+
   // The criteria used for remeshing
   std::vector<GridRefinement::RefinementCriterion> refinement_criteria;
+
+  // The strategy used to mark cells for refinement and coarsening
+  GridRefinement::MarkingStrategy marking_strategy = GridRefinement::Threshold;
+
+  // The fraction of cells (or error) to refine for fixed fraction and number marking
+  double refine_fraction = 0.3;
+
+  // The fraction of cells (or error) to coarsen for fixed fraction and number marking
+  double coarsen_fraction = 0.03;
+
+  // The maximum number of cells for fixed number marking
+  unsigned int max_number_of_cells = UINT_MAX;
+
+  // The source of the cell weights used to partition the mesh
+  GridRefinement::CellWeighting cell_weighting = GridRefinement::Uniform;
+
+  // The ratio of the maximum to the average load above which the mesh is repartitioned
+  double imbalance_threshold = 1.1;
 };
 
 template <unsigned int dim>
@@ -710,6 +891,54 @@ SpatialDiscretization<dim>::postprocess_and_validate()
                       dealii::ExcMessage(
                         "The lower bound of the value-based refinement "
                         "criteria must be less than or equal to the upper bound."));
+
+          // Check that the criteria match the marking strategy
+          if (marking_strategy == GridRefinement::Threshold)
+            {
+              AssertThrow(!criterion.is_error_indicator(),
+                          dealii::ExcMessage(
+                            "The kelly and curvature refinement criteria require the "
+                            "fixed_fraction or fixed_number marking strategy."));
+            }
+          else
+            {
+              AssertThrow(criterion.is_error_indicator(),
+                          dealii::ExcMessage(
+                            "The value and gradient refinement criteria require the "
+                            "threshold marking strategy."));
+            }
+        }
+
+      // Check that the remeshing events can be detected
+      AssertThrow(remeshing_trigger == GridRefinement::Period ||
+                    marking_strategy == GridRefinement::Threshold,
+                  dealii::ExcMessage(
+                    "The event remeshing trigger requires the threshold marking "
+                    "strategy."));
+
+      // Check that the buffer layers do not change the number of refined cells. They are
+      // added after the fixed number of cells is marked, so they could exceed the max
+      // number of cells.
+      AssertThrow(refinement_buffer_layers == 0 ||
+                    marking_strategy != GridRefinement::FixedNumber,
+                  dealii::ExcMessage(
+                    "The refinement buffer layers cannot be used with the fixed_number "
+                    "marking strategy."));
+
+      // Check that the imbalance threshold is valid
+      AssertThrow(imbalance_threshold >= 1.0,
+                  dealii::ExcMessage(
+                    "The repartition imbalance threshold must be greater than or equal "
+                    "to one."));
+
+      // Check that the fractions are valid
+      if (marking_strategy != GridRefinement::Threshold)
+        {
+          AssertThrow((refine_fraction >= 0.0 && coarsen_fraction >= 0.0 &&
+                       refine_fraction + coarsen_fraction <= 1.0),
+                      dealii::ExcMessage(
+                        "The refine and coarsen fractions must be nonnegative and their "
+                        "sum must be less than or equal to one."));
         }
     }
 }
@@ -761,7 +990,43 @@ SpatialDiscretization<dim>::print_parameter_summary() const
     << "Adaptivity enabled: " << bool_to_string(has_adaptivity) << "\n"
     << "Max refinement: " << max_refinement << "\n"
     << "Min refinement: " << min_refinement << "\n"
-    << "Remeshing period: " << remeshing_period << "\n";
+    << "Remeshing period: " << remeshing_period << "\n"
+    << "Remeshing trigger: "
+    << (remeshing_trigger == GridRefinement::Event ? "event" : "period") << "\n"
+    << "Refinement buffer layers: " << refinement_buffer_layers << "\n";
+
+  if (marking_strategy == GridRefinement::FixedFraction)
+    {
+      ConditionalOStreams::pout_summary()
+        << "Marking strategy: fixed fraction\n"
+        << "Refine fraction: " << refine_fraction << "\n"
+        << "Coarsen fraction: " << coarsen_fraction << "\n";
+    }
+  else if (marking_strategy == GridRefinement::FixedNumber)
+    {
+      ConditionalOStreams::pout_summary()
+        << "Marking strategy: fixed number\n"
+        << "Refine fraction: " << refine_fraction << "\n"
+        << "Coarsen fraction: " << coarsen_fraction << "\n"
+        << "Max number of cells: " << max_number_of_cells << "\n";
+    }
+  else
+    {
+      ConditionalOStreams::pout_summary() << "Marking strategy: threshold\n";
+    }
+
+  if (cell_weighting == GridRefinement::User)
+    {
+      ConditionalOStreams::pout_summary()
+        << "Cell weighting: user\n"
+        << "Repartition imbalance threshold: " << imbalance_threshold << "\n";
+    }
+  else if (cell_weighting == GridRefinement::Measured)
+    {
+      ConditionalOStreams::pout_summary()
+        << "Cell weighting: measured\n"
+        << "Repartition imbalance threshold: " << imbalance_threshold << "\n";
+    }
 
   if (!refinement_criteria.empty())
     {
@@ -105,6 +105,19 @@ public:
     increment++;
   }
 
+  /**
+   * @brief Restore the increment, time, and timestep, for example from a checkpoint.
+   *
+   * Note that this function is const even though it changes the state.
+   */
+  void
+  restore(unsigned int _increment, double _time, double _dt) const
+  {
+    increment = _increment;
+    time      = _time;
+    dt        = _dt;
+  }
+
   /**
    * @brief Get the timestep.
    */
@@ -123,6 +136,26 @@ public:
     dt = _dt;
   }
 
+  /**
+   * @brief Get the maximum number of times an increment with a non-finite solution is
+   * rolled back and retried with a smaller timestep.
+   */
+  unsigned int
+  get_max_retries() const
+  {
+    return max_retries;
+  }
+
+  /**
+   * @brief Set the maximum number of times an increment with a non-finite solution is
+   * rolled back and retried with a smaller timestep.
+   */
+  void
+  set_max_retries(unsigned int _max_retries)
+  {
+    max_retries = _max_retries;
+  }
+
 private:
   // The increment
   mutable unsigned int increment = 0;
@@ -138,6 +171,9 @@ private:
 
   // Final time
   double final_time = 0.0;
+
+  // Maximum number of retries of an increment with a non-finite solution
+  unsigned int max_retries = 0;
 };
 
 inline void
@@ -185,7 +221,8 @@ TemporalDiscretization::print_parameter_summary() const
     << "================================================\n"
     << "Timestep: " << dt << "\n"
     << "Total increments: " << total_increments << "\n"
-    << "Final time: " << final_time << "\n\n"
+    << "Final time: " << final_time << "\n"
+    << "Max retries: " << max_retries << "\n\n"
     << std::flush;
 }
 
@@ -11,6 +11,8 @@
 
 #include <prismspf/config.h>
 
+#include <vector>
+
 PRISMS_PF_BEGIN_NAMESPACE
 
 template <unsigned int dim, typename number>
@@ -51,6 +53,37 @@ public:
   [[nodiscard]] const dealii::VectorizedArray<number> &
   get_element_volume(unsigned cell) const;
 
+  /**
+   * @brief Set whether the evaluation cost of each cell batch is recorded.
+   */
+  void
+  set_record_cell_batch_cost(bool _record_cell_batch_cost);
+
+  /**
+   * @brief Whether the evaluation cost of each cell batch is recorded.
+   */
+  [[nodiscard]] bool
+  records_cell_batch_cost() const
+  {
+    return record_cell_batch_cost;
+  }
+
+  /**
+   * @brief Add the measured wall time, in seconds, to the cost of a cell batch.
+   *
+   * This is called from within cell_loop(). Each cell batch is only visited by one
+   * thread, so the accumulation doesn't need to be synchronized.
+   */
+  void
+  add_cell_batch_cost(unsigned int cell, double cost) const;
+
+  /**
+   * @brief Get the accumulated cost of each cell batch since the last time the element
+   * volumes were computed.
+   */
+  [[nodiscard]] const std::vector<double> &
+  get_cell_batch_cost() const;
+
 private:
   /**
    * @brief Matrix-free object.
@@ -61,6 +94,17 @@ private:
    * @brief Vector that stores element volumes
    */
   dealii::AlignedVector<dealii::VectorizedArray<number>> element_volume;
+
+  /**
+   * @brief Whether the evaluation cost of each cell batch is recorded.
+   */
+  bool record_cell_batch_cost = false;
+
+  /**
+   * @brief The accumulated evaluation cost of each cell batch. This is mutable since it
+   * is only instrumentation and is accumulated through const references to the object.
+   */
+  mutable std::vector<double> cell_batch_cost;
 };
 
 /**
@@ -100,6 +144,13 @@ public:
   [[nodiscard]] const ElementVolume<dim, degree, number> &
   get_element_volume() const;
 
+  /**
+   * @brief Set whether the evaluation cost of each cell batch is recorded. This only
+   * applies to the non-multigrid element volumes.
+   */
+  void
+  set_record_cell_batch_cost(bool record_cell_batch_cost);
+
   /**
    * @brief Get the element volume at a multigrid level.
    */
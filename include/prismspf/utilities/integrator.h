@@ -3,23 +3,35 @@
 
 #pragma once
 
-#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/base/vectorization.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
 
 #include <prismspf/config.h>
 
+#include <map>
+#include <memory>
+#include <utility>
 #include <vector>
 
 PRISMS_PF_BEGIN_NAMESPACE
 
 /**
- * @brief Compute the integral of a given field.
+ * @brief Compute the integral of given fields.
+ *
+ * The integrals are evaluated with a matrix-free cell loop over the cell batches, so the
+ * cost is about that of one operator application. Any number of fields are integrated in
+ * the same loop and their components are combined with a single reduction. The integrals
+ * are accumulated and reduced in double precision, whatever the number type of the
+ * fields, so the sum over many cells does not lose the accuracy of single precision.
  */
 template <unsigned int dim, unsigned int degree, typename number>
 class Integrator
 {
 public:
   using VectorType = dealii::LinearAlgebra::distributed::Vector<number>;
+  using SizeType   = dealii::VectorizedArray<number>;
 
   /**
    * @brief Constructor.
@@ -27,20 +39,58 @@ public:
   Integrator() = default;
 
   /**
-   * @brief Compute the integral for a scalar field
+   * @brief Initialize.
    */
   void
-  compute_integral(number                        &integral_value,
-                   const dealii::DoFHandler<dim> &dof_handler,
-                   const VectorType              &vector) const;
+  initialize(std::shared_ptr<dealii::MatrixFree<dim, number, SizeType>> _data);
 
   /**
-   * @brief Compute the integral for a vector field
+   * @brief Compute the integral for a scalar field. The index is that of the field's
+   * DoFHandler in the matrix-free object.
    */
   void
-  compute_integral(std::vector<number>           &integral_value,
-                   const dealii::DoFHandler<dim> &dof_handler,
-                   const VectorType              &vector) const;
+  compute_integral(double           &integral_value,
+                   unsigned int      index,
+                   const VectorType &vector) const;
+
+  /**
+   * @brief Compute the integral for a vector field. The index is that of the field's
+   * DoFHandler in the matrix-free object.
+   */
+  void
+  compute_integral(std::vector<double> &integral_value,
+                   unsigned int         index,
+                   const VectorType    &vector) const;
+
+  /**
+   * @brief Compute the integrals of several fields at once. The integral of each
+   * component is returned for every field, which is given by the index of its DoFHandler
+   * in the matrix-free object. This must be called by every process.
+   */
+  void
+  compute_integrals(std::map<unsigned int, std::vector<double>> &integral_values,
+                    const std::map<unsigned int, VectorType *>  &vectors) const;
+
+private:
+  /**
+   * @brief Integrate a field on a range of cell batches. The integrals of each cell batch
+   * are written to its own slots of batch_values, starting at the given offset.
+   */
+  template <unsigned int n_components>
+  void
+  integrate_cell_batches(
+    const dealii::MatrixFree<dim, number, SizeType> &matrix_free,
+    unsigned int                                     index,
+    const VectorType                                &vector,
+    unsigned int                                     offset,
+    unsigned int                                     n_values_per_batch,
+    dealii::Vector<double>                          &batch_values,
+    const std::pair<unsigned int, unsigned int>     &cell_range) const;
+
+  /**
+   * @brief Matrix-free object.
+   */
+  std::shared_ptr<dealii::MatrixFree<dim, number, SizeType>> data;
 };
 
 PRISMS_PF_END_NAMESPACE
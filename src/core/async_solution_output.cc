@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/numerics/data_out.h>
+
+#include <prismspf/core/async_solution_output.h>
+#include <prismspf/core/solution_output.h>
+
+#include <prismspf/user_inputs/user_input_parameters.h>
+
+#include <prismspf/config.h>
+
+#include <exception>
+#include <map>
+#include <mpi.h>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+template <unsigned int dim, typename number>
+AsyncSolutionOutput<dim, number>::AsyncSolutionOutput(
+  const UserInputParameters<dim> &_user_inputs)
+  : user_inputs(&_user_inputs)
+  , mpi_rank(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD))
+  , n_mpi_processes(dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD))
+{
+  // Only start the worker thread if it is needed
+  if (!user_inputs->get_output_parameters().get_asynchronous_output())
+    {
+      return;
+    }
+
+  const unsigned int n_buffers = user_inputs->get_output_parameters().get_n_buffers();
+  buffer_pool.resize(n_buffers);
+  for (unsigned int buffer_index = 0; buffer_index < n_buffers; ++buffer_index)
+    {
+      free_buffers.push_back(buffer_index);
+    }
+
+  worker = std::thread(&AsyncSolutionOutput::process_jobs, this);
+}
+
+template <unsigned int dim, typename number>
+AsyncSolutionOutput<dim, number>::~AsyncSolutionOutput()
+{
+  if (!worker.joinable())
+    {
+      return;
+    }
+
+  // The worker writes the remaining output before it stops
+  {
+    const std::lock_guard<std::mutex> lock(mutex);
+    finished = true;
+  }
+  condition.notify_all();
+  worker.join();
+}
+
+template <unsigned int dim, typename number>
+void
+AsyncSolutionOutput<dim, number>::enqueue(
+  const std::map<unsigned int, VectorType *>         &solution_set,
+  const std::vector<const dealii::DoFHandler<dim> *> &dof_handlers,
+  const unsigned int                                 &degree,
+  const std::string                                  &name)
+{
+  Assert(worker.joinable(),
+         dealii::ExcMessage("Asynchronous output has not been enabled."));
+
+  rethrow_worker_exception();
+
+  // Grab a free buffer, waiting for the worker if there is none
+  OutputJob job;
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [this] { return !free_buffers.empty(); });
+    job.buffer_index = free_buffers.back();
+    free_buffers.pop_back();
+  }
+
+  // Snapshot the solutions. The worker does not touch this buffer until the job is
+  // queued, so this is done without holding the lock.
+  auto &buffers = buffer_pool[job.buffer_index];
+  for (const auto &[index, variable] : user_inputs->get_variable_attributes())
+    {
+      if (!user_inputs->get_output_parameters().should_output_field(variable))
+        {
+          continue;
+        }
+
+      const auto *solution = solution_set.at(index);
+      auto       &buffer   = buffers[index];
+      if (buffer.get_partitioner() != solution->get_partitioner())
+        {
+          buffer.reinit(solution->get_partitioner());
+        }
+      buffer.copy_locally_owned_data_from(*solution);
+      buffer.update_ghost_values();
+    }
+
+  job.dof_handlers = dof_handlers;
+  job.degree       = degree;
+  job.increment    = user_inputs->get_temporal_discretization().get_increment();
+  job.time         = user_inputs->get_temporal_discretization().get_time();
+  job.name         = name;
+
+  {
+    const std::lock_guard<std::mutex> lock(mutex);
+    jobs.push_back(std::move(job));
+  }
+  condition.notify_all();
+}
+
+template <unsigned int dim, typename number>
+void
+AsyncSolutionOutput<dim, number>::wait()
+{
+  if (!worker.joinable())
+    {
+      return;
+    }
+
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [this] { return free_buffers.size() == buffer_pool.size(); });
+  }
+
+  rethrow_worker_exception();
+}
+
+template <unsigned int dim, typename number>
+void
+AsyncSolutionOutput<dim, number>::process_jobs()
+{
+  while (true)
+    {
+      OutputJob job;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this] { return finished || !jobs.empty(); });
+        if (jobs.empty())
+          {
+            return;
+          }
+        job = std::move(jobs.front());
+        jobs.pop_front();
+      }
+
+      try
+        {
+          std::map<unsigned int, VectorType *> solution_set;
+          for (auto &[index, buffer] : buffer_pool[job.buffer_index])
+            {
+              solution_set[index] = &buffer;
+            }
+
+          dealii::DataOut<dim> data_out;
+          SolutionOutput<dim, number>::add_data_vectors(data_out,
+                                                        solution_set,
+                                                        job.dof_handlers,
+                                                        *user_inputs);
+          SolutionOutput<dim, number>::write_patches(data_out,
+                                                     job.degree,
+                                                     job.name,
+                                                     job.increment,
+                                                     job.time,
+                                                     mpi_rank,
+                                                     n_mpi_processes,
+                                                     false,
+                                                     *user_inputs);
+        }
+      catch (...)
+        {
+          const std::lock_guard<std::mutex> lock(mutex);
+          if (!worker_exception)
+            {
+              worker_exception = std::current_exception();
+            }
+        }
+
+      // Return the buffer to the pool
+      {
+        const std::lock_guard<std::mutex> lock(mutex);
+        free_buffers.push_back(job.buffer_index);
+      }
+      condition.notify_all();
+    }
+}
+
+template <unsigned int dim, typename number>
+void
+AsyncSolutionOutput<dim, number>::rethrow_worker_exception()
+{
+  std::exception_ptr exception;
+  {
+    const std::lock_guard<std::mutex> lock(mutex);
+    std::swap(exception, worker_exception);
+  }
+  if (exception)
+    {
+      std::rethrow_exception(exception);
+    }
+}
+
+#include "core/async_solution_output.inst"
+
+PRISMS_PF_END_NAMESPACE
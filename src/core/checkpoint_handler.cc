@@ -0,0 +1,416 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <prismspf/core/checkpoint_handler.h>
+#include <prismspf/core/conditional_ostreams.h>
+#include <prismspf/core/matrix_free_handler.h>
+#include <prismspf/core/solution_handler.h>
+#include <prismspf/core/solution_output.h>
+#include <prismspf/core/triangulation_handler.h>
+
+#include <prismspf/user_inputs/user_input_parameters.h>
+
+#include <prismspf/config.h>
+
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <mpi.h>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  // The file that records the directory of the latest complete checkpoint
+  const std::string latest_checkpoint_filename = "checkpoint.latest";
+
+  // The file where the cost of each checkpoint is logged
+  const std::string checkpoint_log_filename = "checkpoint.log";
+} // namespace
+
+template <unsigned int dim, typename number>
+CheckpointHandler<dim, number>::CheckpointHandler(
+  const UserInputParameters<dim>   &_user_inputs,
+  const TriangulationHandler<dim>  &_triangulation_handler,
+  SolutionHandler<dim, number>     &_solution_handler,
+  MatrixFreeContainer<dim, number> &_matrix_free_container,
+  XDMFRecord                       &_xdmf_record)
+  : user_inputs(&_user_inputs)
+  , triangulation_handler(&_triangulation_handler)
+  , solution_handler(&_solution_handler)
+  , matrix_free_container(&_matrix_free_container)
+  , xdmf_record(&_xdmf_record)
+{}
+
+template <unsigned int dim, typename number>
+CheckpointHandler<dim, number>::~CheckpointHandler()
+{
+  if (!worker.joinable())
+    {
+      return;
+    }
+
+  // The worker stages the remaining checkpoints before it stops
+  {
+    const std::lock_guard<std::mutex> lock(mutex);
+    finished = true;
+  }
+  condition.notify_all();
+  worker.join();
+}
+
+template <unsigned int dim, typename number>
+void
+CheckpointHandler<dim, number>::save(bool force_flush)
+{
+  rethrow_worker_exception();
+
+  const auto &checkpoint_parameters   = user_inputs->get_checkpoint_parameters();
+  const auto &temporal_discretization = user_inputs->get_temporal_discretization();
+  const unsigned int increment        = temporal_discretization.get_increment();
+  const bool is_root = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0;
+
+  const std::string name = "checkpoint_" + std::to_string(increment);
+  const std::string parent    = checkpoint_parameters.has_fast_directory()
+                                  ? checkpoint_parameters.get_fast_directory()
+                                  : ".";
+  const std::string directory = parent + "/" + name;
+
+  ConditionalOStreams::pout_base()
+    << "saving checkpoint at increment " << increment << "...\n"
+    << std::flush;
+  const auto start = std::chrono::steady_clock::now();
+
+  // Create the directory before any process writes to it
+  if (is_root)
+    {
+      std::filesystem::create_directories(directory);
+    }
+  const int ierr = MPI_Barrier(MPI_COMM_WORLD);
+  AssertThrowMPI(ierr);
+
+  // Write the triangulation with the solution vectors attached to it
+  solution_handler->prepare_for_serialization();
+  triangulation_handler->save(directory + "/triangulation");
+
+  // The attached data is consumed by the save, so the transfer objects are recreated
+  solution_handler->free_solution_transfer();
+  solution_handler->reinit_solution_transfer(*matrix_free_container);
+
+  // Write the time state
+  if (is_root)
+    {
+      std::ofstream state(directory + "/state");
+      state << std::setprecision(std::numeric_limits<double>::max_digits10) << increment
+            << " " << temporal_discretization.get_time() << " "
+            << temporal_discretization.get_timestep() << "\n";
+      AssertThrow(state.good(),
+                  dealii::ExcMessage("Could not write the checkpoint state file."));
+
+      // Only the first process writes the XDMF file, so only its record is saved
+      std::ofstream record(directory + "/xdmf_record");
+      {
+        boost::archive::text_oarchive archive(record);
+        archive << *xdmf_record;
+      }
+      AssertThrow(record.good(),
+                  dealii::ExcMessage("Could not write the checkpoint XDMF record."));
+    }
+
+  const double write_seconds = dealii::Utilities::MPI::max(
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(),
+    MPI_COMM_WORLD);
+  last_write_seconds = write_seconds;
+  ConditionalOStreams::pout_base()
+    << "  checkpoint write time: " << write_seconds << " s\n"
+    << std::flush;
+
+  // Hand the checkpoint to the worker thread
+  n_saved++;
+  if (!is_root)
+    {
+      return;
+    }
+  StagingJob job;
+  job.increment     = increment;
+  job.name          = name;
+  job.flush         = force_flush || !checkpoint_parameters.has_fast_directory() ||
+              n_saved % checkpoint_parameters.get_flush_period() == 0;
+  job.write_seconds = write_seconds;
+  {
+    const std::lock_guard<std::mutex> lock(mutex);
+    jobs.push_back(std::move(job));
+  }
+
+  // Start the worker thread with the first checkpoint, so runs that never checkpoint do
+  // not pay for it
+  if (!worker.joinable())
+    {
+      worker = std::thread(&CheckpointHandler::process_jobs, this);
+    }
+  condition.notify_all();
+}
+
+template <unsigned int dim, typename number>
+void
+CheckpointHandler<dim, number>::wait()
+{
+  if (worker.joinable())
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [this] { return jobs.empty() && !staging; });
+    }
+
+  rethrow_worker_exception();
+}
+
+template <unsigned int dim, typename number>
+double
+CheckpointHandler<dim, number>::get_checkpoint_cost()
+{
+  const std::lock_guard<std::mutex> lock(mutex);
+  return last_write_seconds + last_stage_seconds;
+}
+
+template <unsigned int dim, typename number>
+std::string
+CheckpointHandler<dim, number>::get_triangulation_filename() const
+{
+  return get_latest_directory() + "/triangulation";
+}
+
+template <unsigned int dim, typename number>
+void
+CheckpointHandler<dim, number>::load()
+{
+  const std::string directory = get_latest_directory();
+
+  ConditionalOStreams::pout_base() << "loading checkpoint from " << directory << "...\n"
+                                   << std::flush;
+
+  // Read the solution vectors that were loaded with the triangulation
+  solution_handler->deserialize();
+  solution_handler->free_solution_transfer();
+  solution_handler->reinit_solution_transfer(*matrix_free_container);
+
+  // Restore the time state
+  std::ifstream state(directory + "/state");
+  AssertThrow(state.good(),
+              dealii::ExcMessage("Could not open the checkpoint state file " + directory +
+                                 "/state."));
+  unsigned int increment = 0;
+  double       time      = 0.0;
+  double       dt        = 0.0;
+  state >> increment >> time >> dt;
+  AssertThrow(!state.fail(),
+              dealii::ExcMessage("Could not read the checkpoint state file " + directory +
+                                 "/state."));
+
+  user_inputs->get_temporal_discretization().restore(increment, time, dt);
+
+  // Restore the HDF5 output steps, so the XDMF file keeps indexing the steps before the
+  // restart. The mesh is written again with the next output, since the new partition
+  // may order its vertices differently.
+  const std::string record_filename = directory + "/xdmf_record";
+  if (std::filesystem::exists(record_filename))
+    {
+      std::ifstream                 record(record_filename);
+      boost::archive::text_iarchive archive(record);
+      archive >> *xdmf_record;
+    }
+  xdmf_record->mesh_changed = true;
+}
+
+template <unsigned int dim, typename number>
+std::string
+CheckpointHandler<dim, number>::get_latest_directory() const
+{
+  std::ifstream latest(latest_checkpoint_filename);
+  AssertThrow(latest.good(),
+              dealii::ExcMessage("Could not find a checkpoint to load. The file " +
+                                 latest_checkpoint_filename + " does not exist."));
+
+  std::string directory;
+  latest >> directory;
+  AssertThrow(!directory.empty(),
+              dealii::ExcMessage("The file " + latest_checkpoint_filename +
+                                 " does not name a checkpoint."));
+
+  return directory;
+}
+
+template <unsigned int dim, typename number>
+void
+CheckpointHandler<dim, number>::process_jobs()
+{
+  while (true)
+    {
+      StagingJob job;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this] { return finished || !jobs.empty(); });
+        if (jobs.empty())
+          {
+            return;
+          }
+        job = std::move(jobs.front());
+        jobs.pop_front();
+        staging = true;
+      }
+
+      try
+        {
+          stage(job);
+        }
+      catch (...)
+        {
+          const std::lock_guard<std::mutex> lock(mutex);
+          if (!worker_exception)
+            {
+              worker_exception = std::current_exception();
+            }
+        }
+
+      {
+        const std::lock_guard<std::mutex> lock(mutex);
+        staging = false;
+      }
+      condition.notify_all();
+    }
+}
+
+template <unsigned int dim, typename number>
+void
+CheckpointHandler<dim, number>::stage(const StagingJob &job)
+{
+  const auto &checkpoint_parameters = user_inputs->get_checkpoint_parameters();
+  const auto  start                 = std::chrono::steady_clock::now();
+
+  if (job.flush)
+    {
+      // Copy the checkpoint from fast storage under a temporary name, so an interrupted
+      // copy is never mistaken for a complete checkpoint
+      if (checkpoint_parameters.has_fast_directory())
+        {
+          const std::string temporary = job.name + ".tmp";
+          std::filesystem::remove_all(temporary);
+          std::filesystem::copy(checkpoint_parameters.get_fast_directory() + "/" +
+                                  job.name,
+                                temporary,
+                                std::filesystem::copy_options::recursive);
+          std::filesystem::remove_all(job.name);
+          std::filesystem::rename(temporary, job.name);
+        }
+
+      // Record the checkpoint as the latest. The rename replaces the previous record
+      // atomically.
+      {
+        std::ofstream latest(latest_checkpoint_filename + ".tmp");
+        latest << job.name << "\n";
+      }
+      std::filesystem::rename(latest_checkpoint_filename + ".tmp",
+                              latest_checkpoint_filename);
+
+      delete_old_checkpoints(".", job.increment);
+    }
+  if (checkpoint_parameters.has_fast_directory())
+    {
+      delete_old_checkpoints(checkpoint_parameters.get_fast_directory(), job.increment);
+    }
+
+  const double stage_seconds =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  {
+    const std::lock_guard<std::mutex> lock(mutex);
+    last_stage_seconds = stage_seconds;
+  }
+
+  // Log the cost of the checkpoint
+  const bool    new_log = !std::filesystem::exists(checkpoint_log_filename);
+  std::ofstream log(checkpoint_log_filename, std::ios::app);
+  if (new_log)
+    {
+      log << "increment write_seconds stage_seconds flushed\n";
+    }
+  log << job.increment << " " << job.write_seconds << " " << stage_seconds << " "
+      << (job.flush ? 1 : 0) << "\n";
+}
+
+template <unsigned int dim, typename number>
+void
+CheckpointHandler<dim, number>::delete_old_checkpoints(const std::string &parent,
+                                                       unsigned int max_increment) const
+{
+  const unsigned int n_kept =
+    user_inputs->get_checkpoint_parameters().get_n_kept_checkpoints();
+  if (n_kept == 0)
+    {
+      return;
+    }
+
+  // Find the complete checkpoints in the directory
+  const std::string      prefix = "checkpoint_";
+  std::set<unsigned int> increments;
+  for (const auto &entry : std::filesystem::directory_iterator(parent))
+    {
+      const std::string filename = entry.path().filename().string();
+      if (!entry.is_directory() || !filename.starts_with(prefix) ||
+          filename.size() == prefix.size() ||
+          filename.find_first_not_of("0123456789", prefix.size()) != std::string::npos)
+        {
+          continue;
+        }
+      increments.insert(
+        static_cast<unsigned int>(std::stoul(filename.substr(prefix.size()))));
+    }
+
+  // Delete the oldest ones. The checkpoints newer than the staged one may still be
+  // waiting to be staged, so they are never deleted.
+  auto n_remaining = increments.size();
+  for (const unsigned int increment : increments)
+    {
+      if (n_remaining <= n_kept || increment > max_increment)
+        {
+          break;
+        }
+      std::filesystem::remove_all(parent + "/" + prefix + std::to_string(increment));
+      n_remaining--;
+    }
+}
+
+template <unsigned int dim, typename number>
+void
+CheckpointHandler<dim, number>::rethrow_worker_exception()
+{
+  std::exception_ptr exception;
+  {
+    const std::lock_guard<std::mutex> lock(mutex);
+    std::swap(exception, worker_exception);
+  }
+  if (exception)
+    {
+      std::rethrow_exception(exception);
+    }
+}
+
+#include "core/checkpoint_handler.inst"
+
+PRISMS_PF_END_NAMESPACE
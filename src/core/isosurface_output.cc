@@ -0,0 +1,244 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria_description.h>
+
+#include <prismspf/core/isosurface_output.h>
+
+#include <prismspf/user_inputs/user_input_parameters.h>
+
+#include <prismspf/config.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <mpi.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  // The vtp element that holds the cells of the surface mesh in each dimension
+  const std::array<std::string, 4> cell_element_names = {
+    {"Verts", "Verts", "Lines", "Polys"}
+  };
+} // namespace
+
+template <unsigned int dim, typename number>
+IsosurfaceOutput<dim, number>::IsosurfaceOutput(
+  const std::map<unsigned int, VectorType *>         &solution_set,
+  const std::vector<const dealii::DoFHandler<dim> *> &dof_handlers,
+  const dealii::Mapping<dim>                         &mapping,
+  const unsigned int                                 &degree,
+  const std::string                                  &name,
+  const UserInputParameters<dim>                     &user_inputs)
+{
+  const auto        &output_parameters = user_inputs.get_output_parameters();
+  const unsigned int increment =
+    user_inputs.get_temporal_discretization().get_increment();
+  const unsigned int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int n_mpi_processes =
+    dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  // Follow the naming of the solution output
+  const auto n_trailing_digits = static_cast<unsigned int>(
+    std::floor(
+      std::log10(user_inputs.get_temporal_discretization().get_total_increments())) +
+    1);
+  std::ostringstream increment_stream;
+  increment_stream << std::setw(n_trailing_digits) << std::setfill('0') << increment;
+
+  // Subdivide the cells as many times as the output patches, so the surfaces resolve
+  // the high-order elements the same way
+  const unsigned int n_subdivisions = output_parameters.get_patch_subdivisions() == 0
+                                        ? degree
+                                        : output_parameters.get_patch_subdivisions();
+
+  for (const auto &[index, variable] : user_inputs.get_variable_attributes())
+    {
+      const auto &fields = output_parameters.get_isosurface_fields();
+      if (std::find(fields.begin(), fields.end(), variable.get_name()) == fields.end())
+        {
+          continue;
+        }
+
+      const auto *solution = solution_set.at(index);
+      solution->update_ghost_values();
+
+      const dealii::GridTools::MarchingCubeAlgorithm<dim, VectorType> marching_cubes(
+        mapping,
+        dof_handlers.at(index)->get_fe(),
+        n_subdivisions);
+
+      // Extract the isosurfaces of the cells owned by this process
+      SurfaceMesh surface;
+      for (const double isovalue : output_parameters.get_isosurface_values())
+        {
+          std::vector<dealii::Point<dim>>                       vertices;
+          std::vector<dealii::CellData<dim == 1 ? 1 : dim - 1>> cells;
+          marching_cubes.process(*dof_handlers.at(index),
+                                 *solution,
+                                 isovalue,
+                                 vertices,
+                                 cells);
+
+          // Shift the vertex numbers of the cells past those of the previous values
+          const auto n_previous_vertices =
+            static_cast<unsigned int>(surface.vertices.size());
+          for (auto &cell : cells)
+            {
+              for (auto &vertex : cell.vertices)
+                {
+                  vertex += n_previous_vertices;
+                }
+            }
+          surface.vertices.insert(surface.vertices.end(),
+                                  vertices.begin(),
+                                  vertices.end());
+          surface.cells.insert(surface.cells.end(), cells.begin(), cells.end());
+          surface.isovalues.resize(surface.vertices.size(), isovalue);
+        }
+
+      const std::string base_name =
+        name + "_" + variable.get_name() + "_" + increment_stream.str();
+      const auto piece_name = [&](unsigned int rank)
+      {
+        return base_name + "." + dealii::Utilities::int_to_string(rank, 4) + ".vtp";
+      };
+
+      write_vtp(surface, piece_name(mpi_rank));
+
+      if (mpi_rank == 0)
+        {
+          std::vector<std::string> piece_names;
+          for (unsigned int rank = 0; rank < n_mpi_processes; ++rank)
+            {
+              piece_names.push_back(piece_name(rank));
+            }
+          write_pvtp(piece_names, base_name + ".pvtp");
+        }
+    }
+}
+
+template <unsigned int dim, typename number>
+void
+IsosurfaceOutput<dim, number>::write_vtp(const SurfaceMesh &surface,
+                                         const std::string &filename)
+{
+  std::ofstream output(filename);
+  AssertThrow(output.good(),
+              dealii::ExcMessage("Could not open the isosurface file " + filename + "."));
+  output << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+  // In 1D the isosurfaces are points, which are written as one vertex cell each
+  const bool         points = dim == 1;
+  const unsigned int n_cells =
+    points ? static_cast<unsigned int>(surface.vertices.size())
+           : static_cast<unsigned int>(surface.cells.size());
+  const std::string &cell_name = cell_element_names[dim];
+
+  output << "<?xml version=\"1.0\"?>\n"
+         << "<VTKFile type=\"PolyData\" version=\"1.0\" byte_order=\"LittleEndian\">\n"
+         << "<PolyData>\n"
+         << "<Piece NumberOfPoints=\"" << surface.vertices.size() << "\""
+         << " NumberOfVerts=\"" << (cell_name == "Verts" ? n_cells : 0) << "\""
+         << " NumberOfLines=\"" << (cell_name == "Lines" ? n_cells : 0) << "\""
+         << " NumberOfStrips=\"0\""
+         << " NumberOfPolys=\"" << (cell_name == "Polys" ? n_cells : 0) << "\">\n";
+
+  output << "<PointData Scalars=\"isovalue\">\n"
+         << "<DataArray type=\"Float64\" Name=\"isovalue\" format=\"ascii\">\n";
+  for (const double isovalue : surface.isovalues)
+    {
+      output << isovalue << "\n";
+    }
+  output << "</DataArray>\n</PointData>\n";
+
+  // The points are always written with three coordinates
+  output << "<Points>\n"
+         << "<DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"ascii\">\n";
+  for (const auto &vertex : surface.vertices)
+    {
+      for (unsigned int direction = 0; direction < 3; ++direction)
+        {
+          output << (direction < dim ? vertex[direction] : 0.0)
+                 << (direction < 2 ? " " : "\n");
+        }
+    }
+  output << "</DataArray>\n</Points>\n";
+
+  output << "<" << cell_name << ">\n"
+         << "<DataArray type=\"Int64\" Name=\"connectivity\" format=\"ascii\">\n";
+  for (unsigned int cell = 0; cell < n_cells; ++cell)
+    {
+      if (points)
+        {
+          output << cell << "\n";
+          continue;
+        }
+      for (const auto &vertex : surface.cells[cell].vertices)
+        {
+          output << vertex << " ";
+        }
+      output << "\n";
+    }
+  output << "</DataArray>\n"
+         << "<DataArray type=\"Int64\" Name=\"offsets\" format=\"ascii\">\n";
+  unsigned int offset = 0;
+  for (unsigned int cell = 0; cell < n_cells; ++cell)
+    {
+      offset +=
+        points ? 1 : static_cast<unsigned int>(surface.cells[cell].vertices.size());
+      output << offset << "\n";
+    }
+  output << "</DataArray>\n"
+         << "</" << cell_name << ">\n"
+         << "</Piece>\n"
+         << "</PolyData>\n"
+         << "</VTKFile>\n";
+}
+
+template <unsigned int dim, typename number>
+void
+IsosurfaceOutput<dim, number>::write_pvtp(const std::vector<std::string> &piece_names,
+                                          const std::string              &filename)
+{
+  std::ofstream output(filename);
+  AssertThrow(output.good(),
+              dealii::ExcMessage("Could not open the isosurface record " + filename +
+                                 "."));
+
+  output << "<?xml version=\"1.0\"?>\n"
+         << "<VTKFile type=\"PPolyData\" version=\"1.0\" byte_order=\"LittleEndian\">\n"
+         << "<PPolyData GhostLevel=\"0\">\n"
+         << "<PPointData Scalars=\"isovalue\">\n"
+         << "<PDataArray type=\"Float64\" Name=\"isovalue\"/>\n"
+         << "</PPointData>\n"
+         << "<PPoints>\n"
+         << "<PDataArray type=\"Float64\" NumberOfComponents=\"3\"/>\n"
+         << "</PPoints>\n";
+  for (const auto &piece_name : piece_names)
+    {
+      output << "<Piece Source=\"" << piece_name << "\"/>\n";
+    }
+  output << "</PPolyData>\n"
+         << "</VTKFile>\n";
+}
+
+#include "core/isosurface_output.inst"
+
+PRISMS_PF_END_NAMESPACE
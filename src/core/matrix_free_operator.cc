@@ -2,12 +2,17 @@
 // SPDX-License-Identifier: GNU Lesser General Public Version 2.1
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/point.h>
+#include <deal.II/base/thread_management.h>
 #include <deal.II/base/types.h>
 #include <deal.II/base/vectorization.h>
 #include <deal.II/lac/diagonal_matrix.h>
 #include <deal.II/matrix_free/matrix_free.h>
 
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/string.hpp>
+
 #include <prismspf/core/exceptions.h>
 #include <prismspf/core/matrix_free_operator.h>
 #include <prismspf/core/pde_operator.h>
@@ -22,8 +27,13 @@
 
 #include <prismspf/config.h>
 
+#include <algorithm>
+#include <limits>
 #include <map>
 #include <memory>
+#include <mpi.h>
+#include <mutex>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -227,11 +237,77 @@ MatrixFreeOperator<dim, degree, number>::compute_postprocess_explicit_update(
   Assert(!dst.empty(), dealii::ExcMessage("The dst vector must not be empty"));
   Assert(!src.empty(), dealii::ExcMessage("The src vector must not be empty"));
 
+  local_reductions.clear();
   this->data->cell_loop(&MatrixFreeOperator::compute_local_postprocess_explicit_update,
                         this,
                         dst,
                         src,
                         true);
+
+  // Most kernels register no reductions, so one cheap collective skips the gathering
+  // and reduction below
+  reduction_values.clear();
+  if (!dealii::Utilities::MPI::logical_or(!local_reductions.empty(), MPI_COMM_WORLD))
+    {
+      return;
+    }
+
+  // Some processes may not have seen every reduction, for example if they own no cells,
+  // so the names and types are gathered first
+  std::map<std::string, unsigned int> reduction_types;
+  for (const auto &[name, reduction] : local_reductions)
+    {
+      reduction_types[name] = reduction.first;
+    }
+  for (const auto &types : dealii::Utilities::MPI::all_gather(MPI_COMM_WORLD,
+                                                               reduction_types))
+    {
+      reduction_types.insert(types.begin(), types.end());
+    }
+
+  // Reduce all values at once. Each value is summed, minimized, and maximized, and the
+  // one of its type is kept.
+  std::vector<double> local_values;
+  for (const auto &[name, type] : reduction_types)
+    {
+      const auto iterator = local_reductions.find(name);
+      if (iterator != local_reductions.end())
+        {
+          local_values.push_back(iterator->second.second);
+        }
+      else if (type == ReductionType::Minimum)
+        {
+          local_values.push_back(std::numeric_limits<double>::max());
+        }
+      else if (type == ReductionType::Maximum)
+        {
+          local_values.push_back(std::numeric_limits<double>::lowest());
+        }
+      else
+        {
+          local_values.push_back(0.0);
+        }
+    }
+  const auto reduced_values =
+    dealii::Utilities::MPI::min_max_avg(local_values, MPI_COMM_WORLD);
+
+  unsigned int value_index = 0;
+  for (const auto &[name, type] : reduction_types)
+    {
+      const auto &reduced_value = reduced_values[value_index++];
+      if (type == ReductionType::Minimum)
+        {
+          reduction_values[name] = reduced_value.min;
+        }
+      else if (type == ReductionType::Maximum)
+        {
+          reduction_values[name] = reduced_value.max;
+        }
+      else
+        {
+          reduction_values[name] = reduced_value.sum;
+        }
+    }
 }
 
 template <unsigned int dim, unsigned int degree, typename number>
@@ -370,6 +446,38 @@ MatrixFreeOperator<dim, degree, number>::compute_local_postprocess_explicit_upda
     dst,
     src,
     cell_range);
+
+  // Combine the reductions of this cell range with those of the other threads
+  if (variable_list.get_reductions().empty())
+    {
+      return;
+    }
+  const std::lock_guard<dealii::Threads::Mutex> lock(reduction_mutex);
+  for (const auto &[name, reduction] : variable_list.get_reductions())
+    {
+      const auto &[type, value] = reduction;
+
+      auto [iterator, inserted] = local_reductions.try_emplace(name, type, value);
+      if (inserted)
+        {
+          continue;
+        }
+      double &combined_value = iterator->second.second;
+      switch (type)
+        {
+          case ReductionType::Sum:
+            combined_value += value;
+            break;
+          case ReductionType::Minimum:
+            combined_value = std::min(combined_value, value);
+            break;
+          case ReductionType::Maximum:
+            combined_value = std::max(combined_value, value);
+            break;
+          default:
+            AssertThrow(false, UnreachableCode());
+        }
+    }
 }
 
 template <unsigned int dim, unsigned int degree, typename number>
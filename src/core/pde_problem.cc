@@ -9,11 +9,14 @@
 #include <deal.II/fe/fe_q.h>
 #include <deal.II/fe/fe_system.h>
 
+#include <prismspf/core/async_solution_output.h>
+#include <prismspf/core/checkpoint_handler.h>
 #include <prismspf/core/conditional_ostreams.h>
 #include <prismspf/core/constraint_handler.h>
 #include <prismspf/core/dof_handler.h>
 #include <prismspf/core/grid_refiner.h>
 #include <prismspf/core/invm_handler.h>
+#include <prismspf/core/isosurface_output.h>
 #include <prismspf/core/matrix_free_handler.h>
 #include <prismspf/core/matrix_free_operator.h>
 #include <prismspf/core/multigrid_info.h>
@@ -21,6 +24,7 @@
 #include <prismspf/core/pde_problem.h>
 #include <prismspf/core/solution_handler.h>
 #include <prismspf/core/solution_output.h>
+#include <prismspf/core/solution_statistics.h>
 #include <prismspf/core/solver_handler.h>
 #include <prismspf/core/timer.h>
 #include <prismspf/core/triangulation_handler.h>
@@ -39,13 +43,15 @@
 #include <prismspf/solvers/solver_context.h>
 
 #include <prismspf/utilities/element_volume.h>
-#include <prismspf/utilities/integrator.h>
 
 #include <prismspf/config.h>
 
+#include <chrono>
+#include <csignal>
 #include <memory>
 #include <mpi.h>
 #include <ostream>
+#include <string>
 #include <vector>
 
 #ifdef PRISMS_PF_WITH_CALIPER
@@ -54,6 +60,29 @@
 
 PRISMS_PF_BEGIN_NAMESPACE
 
+namespace
+{
+  // Set when a SIGTERM or SIGUSR1 signal is received
+  volatile std::sig_atomic_t stop_requested = 0;
+
+  void
+  request_stop(int /*signal*/)
+  {
+    stop_requested = 1;
+  }
+
+  // Weight of the latest increment in the moving average of the time per increment
+  constexpr double increment_time_weight = 0.2;
+
+  // The wall time that must remain to finish another increment and a checkpoint is
+  // scaled by this factor
+  constexpr double wall_time_safety_factor = 1.5;
+
+  // Before the first checkpoint is measured, this fraction of the max wall time is
+  // reserved for the final checkpoint
+  constexpr double unmeasured_checkpoint_fraction = 0.05;
+} // namespace
+
 template <unsigned int dim, unsigned int degree, typename number>
 PDEProblem<dim, degree, number>::PDEProblem(
   const UserInputParameters<dim>                                &_user_inputs,
@@ -90,9 +119,18 @@ PDEProblem<dim, degree, number>::PDEProblem(
                          fe_system,
                          mapping,
                          element_volume_container,
-                         mg_info)
+                         mg_info,
+                         _pde_operator)
   , grid_refiner(grid_refiner_context)
   , solver_handler(solver_context)
+  , solution_output(_user_inputs)
+  , checkpoint_handler(_user_inputs,
+                       triangulation_handler,
+                       solution_handler,
+                       matrix_free_container,
+                       xdmf_record)
+  , solution_statistics(_user_inputs)
+  , start_time(std::chrono::steady_clock::now())
 {}
 
 template <unsigned int dim, unsigned int degree, typename number>
@@ -143,7 +181,10 @@ PDEProblem<dim, degree, number>::init_system()
   // Create the mesh
   ConditionalOStreams::pout_base() << "creating triangulation...\n" << std::flush;
   Timer::start_section("Generate mesh");
-  triangulation_handler.generate_mesh();
+  const bool restart =
+    user_inputs->get_checkpoint_parameters().get_load_from_checkpoint();
+  triangulation_handler.generate_mesh(
+    restart ? checkpoint_handler.get_triangulation_filename() : "");
   Timer::end_section("Generate mesh");
 
   // Print multigrid info
@@ -208,7 +249,21 @@ PDEProblem<dim, degree, number>::init_system()
   // Perform the initial grid refinement. For this one, we have to do a loop to sufficient
   // coarsen cells to the minimum level
   ConditionalOStreams::pout_base() << "initializing grid refiner..." << std::flush;
-  grid_refiner.init(fe_system);
+  grid_refiner.init();
+
+  // When restarting, the adapted mesh and the solutions come from the checkpoint and the
+  // initial condition has already been written
+  if (restart)
+    {
+      Timer::start_section("Load checkpoint");
+      checkpoint_handler.load();
+      Timer::end_section("Load checkpoint");
+
+      Timer::start_section("Update ghosts");
+      solution_handler.update_ghosts();
+      Timer::end_section("Update ghosts");
+      return;
+    }
   dealii::types::global_dof_index old_dofs = dof_handler.get_total_dofs();
   dealii::types::global_dof_index new_dofs = 0;
   for (unsigned int remesh_index = 0;
@@ -219,9 +274,15 @@ PDEProblem<dim, degree, number>::init_system()
       // Perform grid refinement
       ConditionalOStreams::pout_base() << "performing grid refinement...\n" << std::flush;
       Timer::start_section("Grid refinement");
-      grid_refiner.do_adaptive_refinement();
+      const bool grid_changed = grid_refiner.do_adaptive_refinement();
       Timer::end_section("Grid refinement");
 
+      // Stop if the grid didn't change
+      if (!grid_changed)
+        {
+          break;
+        }
+
       // Reinitialize the solver types
       solver_handler.reinit();
 
@@ -246,50 +307,17 @@ PDEProblem<dim, degree, number>::init_system()
   // Output initial condition
   Timer::start_section("Output");
   ConditionalOStreams::pout_base() << "outputting initial condition...\n" << std::flush;
-  SolutionOutput<dim, number>(solution_handler.get_solution_vector(),
-                              dof_handler.get_dof_handlers(),
-                              degree,
-                              "solution",
-                              *user_inputs);
-
-  // Print the l2-norms and integrals of each solution
-  ConditionalOStreams::pout_base()
-    << "Iteration: " << user_inputs->get_temporal_discretization().get_increment()
-    << "\n";
-  for (const auto &[index, vector] : solution_handler.get_solution_vector())
+  write_solution_output();
+
+  // Print the statistics of each solution
+  solution_statistics.compute(matrix_free_container.get_matrix_free(),
+                              solution_handler.get_solution_vector());
+  solution_statistics.set_reductions(solver_handler.get_reductions());
+  solution_statistics.print();
+  if (user_inputs->get_output_parameters().should_log_statistics(0))
     {
-      ConditionalOStreams::pout_base()
-        << "  Solution index " << index << " l2-norm: " << vector->l2_norm()
-        << " integrated value: ";
-
-      const auto local_field_type =
-        user_inputs->get_variable_attributes().at(index).get_field_type();
-
-      if (local_field_type == FieldType::Vector)
-        {
-          std::vector<number> integrated_values(dim, 0.0);
-          integrator.compute_integral(integrated_values,
-                                      *dof_handler.get_dof_handlers()[index],
-                                      *vector);
-
-          for (unsigned int dimension = 0; dimension < dim; dimension++)
-            {
-              ConditionalOStreams::pout_base() << integrated_values[dimension] << " ";
-            }
-        }
-      else
-        {
-          number integrated_value = 0.0;
-          integrator.compute_integral(integrated_value,
-                                      *dof_handler.get_dof_handlers()[index],
-                                      *vector);
-
-          ConditionalOStreams::pout_base() << integrated_value;
-        }
-
-      ConditionalOStreams::pout_base() << "\n";
+      solution_statistics.write_log();
     }
-  ConditionalOStreams::pout_base() << "\n" << std::flush;
   Timer::end_section("Output");
 }
 
@@ -325,6 +353,8 @@ PDEProblem<dim, degree, number>::solve_increment()
     user_inputs->get_spatial_discretization().should_refine_mesh(
       user_inputs->get_temporal_discretization().get_increment()) ||
     user_inputs->get_output_parameters().should_output(
+      user_inputs->get_temporal_discretization().get_increment()) ||
+    user_inputs->get_output_parameters().should_log_statistics(
       user_inputs->get_temporal_discretization().get_increment());
 
   // Solve a single increment
@@ -332,6 +362,56 @@ PDEProblem<dim, degree, number>::solve_increment()
                        update_postprocssed);
 }
 
+template <unsigned int dim, unsigned int degree, typename number>
+void
+PDEProblem<dim, degree, number>::advance_increment()
+{
+  const auto        &temporal_discretization = user_inputs->get_temporal_discretization();
+  const unsigned int max_retries             = temporal_discretization.get_max_retries();
+  const unsigned int increment               = temporal_discretization.get_increment();
+  const double       time                    = temporal_discretization.get_time();
+  const double       dt                      = temporal_discretization.get_timestep();
+
+  // Keep the last good state in memory so the increment can be rolled back
+  if (max_retries > 0)
+    {
+      solution_handler.save_snapshot();
+    }
+
+  for (unsigned int retry = 0;; retry++)
+    {
+      // Each retry halves the timestep of the substeps
+      const unsigned int n_substeps = 1U << retry;
+      temporal_discretization.restore(increment + 1, time, dt / n_substeps);
+      solution_handler.reset_finite_check();
+
+      bool finite = true;
+      for (unsigned int substep = 0; substep < n_substeps && finite; substep++)
+        {
+          temporal_discretization.update_time();
+          solve_increment();
+          finite = solution_handler.solution_is_finite();
+        }
+      if (finite)
+        {
+          break;
+        }
+
+      AssertThrow(retry < max_retries,
+                  dealii::ExcMessage("The solution became non-finite at increment " +
+                                     std::to_string(increment + 1) + " after " +
+                                     std::to_string(retry) + " retries."));
+      ConditionalOStreams::pout_base()
+        << "Warning: the solution became non-finite at increment " << increment + 1
+        << ". Rolling back and retrying with " << 2 * n_substeps << " substeps.\n"
+        << std::flush;
+      solution_handler.restore_snapshot();
+    }
+
+  // Restore the timestep. The time is set directly so the substeps leave no round-off.
+  temporal_discretization.restore(increment + 1, time + dt, dt);
+}
+
 template <unsigned int dim, unsigned int degree, typename number>
 void
 PDEProblem<dim, degree, number>::solve()
@@ -359,17 +439,44 @@ PDEProblem<dim, degree, number>::solve()
        "  Solve\n"
     << "================================================\n"
     << std::flush;
+
+  // Stop cleanly, with a checkpoint, when the batch scheduler signals the end of the job
+  // or the max wall time is near. This is only done if checkpoints are used, which is not
+  // possible in 1D.
+  const auto &checkpoint_parameters = user_inputs->get_checkpoint_parameters();
+  const bool  check_stop =
+    dim > 1 && (checkpoint_parameters.has_checkpoints() ||
+                checkpoint_parameters.has_max_wall_time());
+  stop_requested                     = 0;
+  decltype(SIG_DFL) previous_sigterm = SIG_DFL;
+  decltype(SIG_DFL) previous_sigusr1 = SIG_DFL;
+  if (check_stop)
+    {
+      previous_sigterm = std::signal(SIGTERM, request_stop);
+      previous_sigusr1 = std::signal(SIGUSR1, request_stop);
+    }
+
   while (user_inputs->get_temporal_discretization().get_increment() <
          user_inputs->get_temporal_discretization().get_total_increments())
     {
-      user_inputs->get_temporal_discretization().update_increment();
-      user_inputs->get_temporal_discretization().update_time();
+      const auto increment_start = std::chrono::steady_clock::now();
 
       Timer::start_section("Solve Increment");
-      solve_increment();
+      advance_increment();
       Timer::end_section("Solve Increment");
 
-      if (user_inputs->get_spatial_discretization().should_refine_mesh(
+      // Check whether the refinement criteria are met outside the refined region
+      bool remeshing_event = false;
+      if (user_inputs->get_spatial_discretization().should_check_remeshing_event(
+            user_inputs->get_temporal_discretization().get_increment()))
+        {
+          Timer::start_section("Check remeshing event");
+          remeshing_event = grid_refiner.criteria_met_outside_refined_region();
+          Timer::end_section("Check remeshing event");
+        }
+
+      if (remeshing_event ||
+          user_inputs->get_spatial_discretization().should_refine_mesh(
             user_inputs->get_temporal_discretization().get_increment()))
         {
           // Perform grid refinement
@@ -378,69 +485,175 @@ PDEProblem<dim, degree, number>::solve()
             << user_inputs->get_temporal_discretization().get_increment() << "...\n"
             << std::flush;
           Timer::start_section("Grid refinement");
-          grid_refiner.do_adaptive_refinement();
+          // The pending output refers to the current DoFHandlers
+          solution_output.wait();
+          const bool grid_changed = grid_refiner.do_adaptive_refinement();
           Timer::end_section("Grid refinement");
 
-          // Reinitialize the solver types
-          solver_handler.reinit();
+          // Reinitialize the solver types if the grid changed
+          if (grid_changed)
+            {
+              solver_handler.reinit();
+
+              // The mesh must be written again with the next HDF5 output
+              xdmf_record.mesh_changed = true;
 
-          // Update the ghosts
-          Timer::start_section("Update ghosts");
-          solution_handler.update_ghosts();
-          Timer::end_section("Update ghosts");
+              // Update the ghosts
+              Timer::start_section("Update ghosts");
+              solution_handler.update_ghosts();
+              Timer::end_section("Update ghosts");
+            }
         }
-      if (user_inputs->get_output_parameters().should_output(
-            user_inputs->get_temporal_discretization().get_increment()))
-        {
-          Timer::start_section("Output");
-          SolutionOutput<dim, number>(solution_handler.get_solution_vector(),
-                                      dof_handler.get_dof_handlers(),
-                                      degree,
-                                      "solution",
-                                      *user_inputs);
 
-          // Print the l2-norms and integrals of each solution
-          ConditionalOStreams::pout_base()
-            << "Iteration: " << user_inputs->get_temporal_discretization().get_increment()
-            << "\n";
-          for (const auto &[index, vector] : solution_handler.get_solution_vector())
+      // Compute the statistics of the solutions once for the output and the log
+      const unsigned int increment =
+        user_inputs->get_temporal_discretization().get_increment();
+      const bool output = user_inputs->get_output_parameters().should_output(increment);
+      const bool log_statistics =
+        user_inputs->get_output_parameters().should_log_statistics(increment);
+      if (output || log_statistics)
+        {
+          Timer::start_section("Statistics");
+          solution_statistics.compute(matrix_free_container.get_matrix_free(),
+                                      solution_handler.get_solution_vector());
+          solution_statistics.set_reductions(solver_handler.get_reductions());
+          if (log_statistics)
             {
-              ConditionalOStreams::pout_base()
-                << "  Solution index " << index << " l2-norm: " << vector->l2_norm()
-                << " integrated value: ";
-
-              const auto local_field_type =
-                user_inputs->get_variable_attributes().at(index).get_field_type();
-
-              if (local_field_type == FieldType::Vector)
-                {
-                  std::vector<number> integrated_values(dim, 0.0);
-                  integrator.compute_integral(integrated_values,
-                                              *dof_handler.get_dof_handlers()[index],
-                                              *vector);
-
-                  for (unsigned int dimension = 0; dimension < dim; dimension++)
-                    {
-                      ConditionalOStreams::pout_base()
-                        << integrated_values[dimension] << " ";
-                    }
-                }
-              else
-                {
-                  number integrated_value = 0.0;
-                  integrator.compute_integral(integrated_value,
-                                              *dof_handler.get_dof_handlers()[index],
-                                              *vector);
-
-                  ConditionalOStreams::pout_base() << integrated_value;
-                }
-
-              ConditionalOStreams::pout_base() << "\n";
+              solution_statistics.write_log();
             }
-          ConditionalOStreams::pout_base() << "\n" << std::flush;
+          Timer::end_section("Statistics");
+        }
+      if (output)
+        {
+          Timer::start_section("Output");
+          write_solution_output();
+          solution_statistics.print();
           Timer::end_section("Output");
         }
+
+      const bool stop =
+        check_stop &&
+        should_stop(std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                                  increment_start)
+                      .count());
+      if (stop || checkpoint_parameters.should_checkpoint(
+                    user_inputs->get_temporal_discretization().get_increment()))
+        {
+          Timer::start_section("Checkpoint");
+          checkpoint_handler.save(stop);
+          Timer::end_section("Checkpoint");
+        }
+      if (stop)
+        {
+          ConditionalOStreams::pout_base()
+            << "stopping at increment "
+            << user_inputs->get_temporal_discretization().get_increment()
+            << ". Set load from checkpoint to true to continue the simulation.\n"
+            << std::flush;
+          break;
+        }
     }
+
+  if (check_stop)
+    {
+      std::signal(SIGTERM, previous_sigterm);
+      std::signal(SIGUSR1, previous_sigusr1);
+    }
+
+  // Wait for the pending output to be written
+  Timer::start_section("Output");
+  solution_output.wait();
+  Timer::end_section("Output");
+
+  // Wait for the pending checkpoints to be staged
+  Timer::start_section("Checkpoint");
+  checkpoint_handler.wait();
+  Timer::end_section("Checkpoint");
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+PDEProblem<dim, degree, number>::write_solution_output()
+{
+  if (user_inputs->get_output_parameters().has_isosurfaces())
+    {
+      IsosurfaceOutput<dim, number>(solution_handler.get_solution_vector(),
+                                    dof_handler.get_dof_handlers(),
+                                    mapping,
+                                    degree,
+                                    "solution",
+                                    *user_inputs);
+      if (user_inputs->get_output_parameters().get_isosurfaces_only())
+        {
+          return;
+        }
+    }
+
+  if (user_inputs->get_output_parameters().get_asynchronous_output())
+    {
+      solution_output.enqueue(solution_handler.get_solution_vector(),
+                              dof_handler.get_dof_handlers(),
+                              degree,
+                              "solution");
+    }
+  else
+    {
+      SolutionOutput<dim, number>(solution_handler.get_solution_vector(),
+                                  dof_handler.get_dof_handlers(),
+                                  degree,
+                                  "solution",
+                                  *user_inputs,
+                                  &xdmf_record);
+    }
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+bool
+PDEProblem<dim, degree, number>::should_stop(double increment_seconds)
+{
+  const auto &temporal_discretization = user_inputs->get_temporal_discretization();
+  const auto &checkpoint_parameters   = user_inputs->get_checkpoint_parameters();
+
+  average_increment_seconds =
+    average_increment_seconds == 0.0
+      ? increment_seconds
+      : ((1.0 - increment_time_weight) * average_increment_seconds) +
+          (increment_time_weight * increment_seconds);
+
+  // There is nothing to save after the last increment
+  const unsigned int increment = temporal_discretization.get_increment();
+  if (increment >= temporal_discretization.get_total_increments())
+    {
+      return false;
+    }
+
+  bool stop = stop_requested != 0;
+  if (checkpoint_parameters.has_max_wall_time())
+    {
+      const double elapsed_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+          .count();
+      double checkpoint_seconds = checkpoint_handler.get_checkpoint_cost();
+      if (checkpoint_seconds == 0.0)
+        {
+          checkpoint_seconds =
+            unmeasured_checkpoint_fraction * checkpoint_parameters.get_max_wall_time();
+        }
+
+      // Stop if there may not be time for another increment and a checkpoint
+      const double margin_seconds =
+        wall_time_safety_factor * (average_increment_seconds + checkpoint_seconds);
+      if (elapsed_seconds + margin_seconds > checkpoint_parameters.get_max_wall_time())
+        {
+          stop = true;
+        }
+    }
+
+  // The signal may only reach some of the processes, so any process can stop all of them.
+  // This is checked after every increment, since the scheduler may kill the job soon
+  // after the signal, and one reduction of an integer is cheap next to an increment.
+  return dealii::Utilities::MPI::max(static_cast<unsigned int>(stop), MPI_COMM_WORLD) !=
+         0;
 }
 
 template <unsigned int dim, unsigned int degree, typename number>
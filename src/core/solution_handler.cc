@@ -3,6 +3,7 @@
 
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/distributed/solution_transfer.h>
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/matrix_free/evaluation_flags.h>
@@ -18,6 +19,8 @@
 #include <prismspf/config.h>
 
 #include <array>
+#include <cmath>
+#include <cstddef>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -173,9 +176,6 @@ SolutionHandler<dim, number>::init(
         {
           solution_set[std::make_pair(index, DependencyType::Normal)] =
             std::make_unique<VectorType>();
-          solution_transfer_set[std::make_pair(index, DependencyType::Normal)] =
-            std::make_unique<SolutionTransfer>(
-              matrix_free_container.get_matrix_free()->get_dof_handler(index));
           new_solution_set[index] = std::make_unique<VectorType>();
         }
       new_solution_set.try_emplace(index, std::make_unique<VectorType>());
@@ -195,10 +195,6 @@ SolutionHandler<dim, number>::init(
               solution_set.try_emplace(
                 std::make_pair(field_index, static_cast<DependencyType>(dep_index)),
                 std::make_unique<VectorType>());
-              solution_transfer_set.try_emplace(
-                std::make_pair(field_index, static_cast<DependencyType>(dep_index)),
-                std::make_unique<SolutionTransfer>(
-                  matrix_free_container.get_matrix_free()->get_dof_handler(field_index)));
 
               dep_index++;
             }
@@ -219,10 +215,6 @@ SolutionHandler<dim, number>::init(
               solution_set.try_emplace(
                 std::make_pair(field_index, static_cast<DependencyType>(dep_index)),
                 std::make_unique<VectorType>());
-              solution_transfer_set.try_emplace(
-                std::make_pair(field_index, static_cast<DependencyType>(dep_index)),
-                std::make_unique<SolutionTransfer>(
-                  matrix_free_container.get_matrix_free()->get_dof_handler(field_index)));
 
               dep_index++;
             }
@@ -231,6 +223,21 @@ SolutionHandler<dim, number>::init(
         }
     }
 
+  // Create the solution transfer objects
+  reinit_solution_transfer(matrix_free_container);
+
+  // Create the spare history vector for fields with old solutions
+  for (const auto &[pair, solution] : solution_set)
+    {
+      if (pair.second == DependencyType::OldOne ||
+          pair.second == DependencyType::OldTwo ||
+          pair.second == DependencyType::OldThree ||
+          pair.second == DependencyType::OldFour)
+        {
+          history_set.try_emplace(pair.first, std::make_unique<VectorType>());
+        }
+    }
+
   // Initialize the entries according to the corresponding matrix free index
   for (const auto &[pair, solution] : solution_set)
     {
@@ -242,6 +249,10 @@ SolutionHandler<dim, number>::init(
       matrix_free_container.get_matrix_free()->initialize_dof_vector(*new_solution,
                                                                      index);
     }
+  for (const auto &[index, history] : history_set)
+    {
+      matrix_free_container.get_matrix_free()->initialize_dof_vector(*history, index);
+    }
 
   // Create all entries and initialize them
   for (unsigned int level = 0; level < mg_solution_set.size(); level++)
@@ -273,6 +284,10 @@ SolutionHandler<dim, number>::reinit(
       matrix_free_container.get_matrix_free()->initialize_dof_vector(*new_solution,
                                                                      index);
     }
+  for (const auto &[index, history] : history_set)
+    {
+      matrix_free_container.get_matrix_free()->initialize_dof_vector(*history, index);
+    }
 
   // Loop over all entries and reinitialize them
   for (unsigned int level = 0; level < mg_solution_set.size(); level++)
@@ -291,62 +306,96 @@ void
 SolutionHandler<dim, number>::reinit_solution_transfer(
   MatrixFreeContainer<dim, number> &matrix_free_container)
 {
-  // Create all entries
-  for (const auto &[index, variable] : *attributes_list)
+  // Create one transfer object for each field, which packs all of its vectors
+  for (const auto &[pair, solution] : solution_set)
     {
-      // Add the variable if it doesn't already exist
-      if (!solution_transfer_set.contains(std::make_pair(index, DependencyType::Normal)))
+      if (!solution_transfer_set.contains(pair.first))
         {
-          solution_transfer_set[std::make_pair(index, DependencyType::Normal)] =
-            std::make_unique<SolutionTransfer>(
-              matrix_free_container.get_matrix_free()->get_dof_handler(index));
+          solution_transfer_set[pair.first] = std::make_unique<SolutionTransfer>(
+            matrix_free_container.get_matrix_free()->get_dof_handler(pair.first));
         }
+    }
+}
 
-      // Add dependencies if they don't exist
-      Types::Index field_index = 0;
-      for (const auto &dependency_set : variable.get_eval_flag_set_rhs())
-        {
-          Types::Index dep_index = 0;
-          for (const auto &value : dependency_set)
-            {
-              if (value == dealii::EvaluationFlags::EvaluationFlags::nothing)
-                {
-                  dep_index++;
-                  continue;
-                }
+template <unsigned int dim, typename number>
+void
+SolutionHandler<dim, number>::prepare_for_solution_transfer()
+{
+  Assert(!solution_transfer_set.empty() || solution_set.empty(),
+         dealii::ExcNotInitialized());
 
-              solution_transfer_set.try_emplace(
-                std::make_pair(field_index, static_cast<DependencyType>(dep_index)),
-                std::make_unique<SolutionTransfer>(
-                  matrix_free_container.get_matrix_free()->get_dof_handler(field_index)));
+  std::map<unsigned int, std::vector<const VectorType *>> field_solutions;
+  for (const auto &[pair, solution] : solution_set)
+    {
+      field_solutions[pair.first].push_back(solution.get());
+    }
+  for (const auto &[index, solutions] : field_solutions)
+    {
+      auto &transfer = solution_transfer_set.at(index);
+      Assert(transfer, dealii::ExcInternalError());
+      transfer->prepare_for_coarsening_and_refinement(solutions);
+    }
+}
 
-              dep_index++;
-            }
+template <unsigned int dim, typename number>
+void
+SolutionHandler<dim, number>::execute_solution_transfer()
+{
+  Assert(!solution_transfer_set.empty() || solution_set.empty(),
+         dealii::ExcNotInitialized());
 
-          field_index++;
-        }
-      field_index = 0;
-      for (const auto &dependency_set : variable.get_eval_flag_set_lhs())
-        {
-          Types::Index dep_index = 0;
-          for (const auto &value : dependency_set)
-            {
-              if (value == dealii::EvaluationFlags::EvaluationFlags::nothing)
-                {
-                  dep_index++;
-                  continue;
-                }
+  // The vectors are gathered in the same order as in prepare_for_solution_transfer()
+  std::map<unsigned int, std::vector<VectorType *>> field_solutions;
+  for (const auto &[pair, solution] : solution_set)
+    {
+      field_solutions[pair.first].push_back(solution.get());
+    }
+  for (auto &[index, solutions] : field_solutions)
+    {
+      auto &transfer = solution_transfer_set.at(index);
+      Assert(transfer, dealii::ExcInternalError());
+      transfer->interpolate(solutions);
+    }
+}
 
-              solution_transfer_set.try_emplace(
-                std::make_pair(field_index, static_cast<DependencyType>(dep_index)),
-                std::make_unique<SolutionTransfer>(
-                  matrix_free_container.get_matrix_free()->get_dof_handler(field_index)));
+template <unsigned int dim, typename number>
+void
+SolutionHandler<dim, number>::prepare_for_serialization()
+{
+  Assert(!solution_transfer_set.empty() || solution_set.empty(),
+         dealii::ExcNotInitialized());
 
-              dep_index++;
-            }
+  std::map<unsigned int, std::vector<const VectorType *>> field_solutions;
+  for (const auto &[pair, solution] : solution_set)
+    {
+      field_solutions[pair.first].push_back(solution.get());
+    }
+  for (const auto &[index, solutions] : field_solutions)
+    {
+      auto &transfer = solution_transfer_set.at(index);
+      Assert(transfer, dealii::ExcInternalError());
+      transfer->prepare_for_serialization(solutions);
+    }
+}
 
-          field_index++;
-        }
+template <unsigned int dim, typename number>
+void
+SolutionHandler<dim, number>::deserialize()
+{
+  Assert(!solution_transfer_set.empty() || solution_set.empty(),
+         dealii::ExcNotInitialized());
+
+  // The vectors are gathered in the same order as in prepare_for_serialization()
+  std::map<unsigned int, std::vector<VectorType *>> field_solutions;
+  for (const auto &[pair, solution] : solution_set)
+    {
+      field_solutions[pair.first].push_back(solution.get());
+    }
+  for (auto &[index, solutions] : field_solutions)
+    {
+      auto &transfer = solution_transfer_set.at(index);
+      Assert(transfer, dealii::ExcInternalError());
+      transfer->deserialize(solutions);
     }
 }
 
@@ -367,6 +416,13 @@ SolutionHandler<dim, number>::update_ghosts() const
     }
 }
 
+template <unsigned int dim, typename number>
+void
+SolutionHandler<dim, number>::update_ghosts(unsigned int index) const
+{
+  solution_set.at(std::make_pair(index, DependencyType::Normal))->update_ghost_values();
+}
+
 template <unsigned int dim, typename number>
 void
 SolutionHandler<dim, number>::zero_out_ghosts() const
@@ -421,20 +477,7 @@ SolutionHandler<dim, number>::update(FieldSolveType field_solve_type,
     new_vector->swap(*(solution_set.at(std::make_pair(index, DependencyType::Normal))));
 
     // Swap old dependency types if they exist
-    const std::array<DependencyType, 4> old_types = {
-      {DependencyType::OldOne,
-       DependencyType::OldTwo,
-       DependencyType::OldThree,
-       DependencyType::OldFour}
-    };
-
-    for (const auto &dep_type : old_types)
-      {
-        if (solution_set.contains(std::make_pair(index, dep_type)))
-          {
-            new_vector->swap(*(solution_set.at(std::make_pair(index, dep_type))));
-          }
-      }
+    rotate_old_solutions(index, *new_vector);
   };
 
   // Loop through the solutions and swap them
@@ -481,6 +524,144 @@ SolutionHandler<dim, number>::update(FieldSolveType field_solve_type,
     }
 }
 
+template <unsigned int dim, typename number>
+void
+SolutionHandler<dim, number>::prepare_history(Types::Index index)
+{
+  if (!history_set.contains(index))
+    {
+      return;
+    }
+
+  *history_set.at(index) =
+    *(solution_set.at(std::make_pair(index, DependencyType::Normal)));
+}
+
+template <unsigned int dim, typename number>
+void
+SolutionHandler<dim, number>::rotate_history(Types::Index index)
+{
+  if (!history_set.contains(index))
+    {
+      return;
+    }
+
+  rotate_old_solutions(index, *history_set.at(index));
+}
+
+template <unsigned int dim, typename number>
+void
+SolutionHandler<dim, number>::rotate_old_solutions(Types::Index index, VectorType &spare)
+{
+  const std::array<DependencyType, 4> old_types = {
+    {DependencyType::OldOne,
+     DependencyType::OldTwo,
+     DependencyType::OldThree,
+     DependencyType::OldFour}
+  };
+
+  for (const auto &dep_type : old_types)
+    {
+      if (solution_set.contains(std::make_pair(index, dep_type)))
+        {
+          spare.swap(*(solution_set.at(std::make_pair(index, dep_type))));
+        }
+    }
+}
+
+template <unsigned int dim, typename number>
+void
+SolutionHandler<dim, number>::scale_new_solution(unsigned int      index,
+                                                 const VectorType &scaling)
+{
+  auto &vector = *new_solution_set.at(index);
+  AssertDimension(vector.locally_owned_size(), scaling.locally_owned_size());
+
+  // Fuse the check into the scaling so the vector is only traversed once
+  number       *values         = vector.begin();
+  const number *scaling_values = scaling.begin();
+  bool          finite         = true;
+  const auto    n_local        = vector.locally_owned_size();
+  for (std::size_t i = 0; i < n_local; i++)
+    {
+      values[i] *= scaling_values[i];
+      finite &= std::isfinite(values[i]);
+    }
+  finite_new_solutions[index] = finite;
+}
+
+template <unsigned int dim, typename number>
+void
+SolutionHandler<dim, number>::add_to_solution(unsigned int      index,
+                                              number            factor,
+                                              const VectorType &update)
+{
+  auto &vector = *solution_set.at(std::make_pair(index, DependencyType::Normal));
+  AssertDimension(vector.locally_owned_size(), update.locally_owned_size());
+
+  // Fuse the check into the update so the vector is only traversed once
+  number       *values        = vector.begin();
+  const number *update_values = update.begin();
+  bool          finite        = true;
+  const auto    n_local       = vector.locally_owned_size();
+  for (std::size_t i = 0; i < n_local; i++)
+    {
+      values[i] += factor * update_values[i];
+      finite &= std::isfinite(values[i]);
+    }
+  finite_solutions[index] = finite;
+}
+
+template <unsigned int dim, typename number>
+bool
+SolutionHandler<dim, number>::solution_is_finite() const
+{
+  // Only the latest update of each vector counts, since every check covers all of its
+  // locally owned values
+  bool finite = true;
+  for (const auto &[index, solution_finite] : finite_solutions)
+    {
+      finite = finite && solution_finite;
+    }
+  for (const auto &[index, new_solution_finite] : finite_new_solutions)
+    {
+      finite = finite && new_solution_finite;
+    }
+
+  return dealii::Utilities::MPI::min(static_cast<unsigned int>(finite), MPI_COMM_WORLD) !=
+         0;
+}
+
+template <unsigned int dim, typename number>
+void
+SolutionHandler<dim, number>::save_snapshot()
+{
+  for (const auto &[pair, solution] : solution_set)
+    {
+      auto &snapshot = snapshot_set[pair];
+      if (snapshot.get_partitioner() != solution->get_partitioner())
+        {
+          snapshot.reinit(solution->get_partitioner());
+        }
+      snapshot.copy_locally_owned_data_from(*solution);
+    }
+}
+
+template <unsigned int dim, typename number>
+void
+SolutionHandler<dim, number>::restore_snapshot()
+{
+  // Copy into the existing vectors, since the solvers hold pointers to them
+  for (const auto &[pair, solution] : solution_set)
+    {
+      const auto &snapshot = snapshot_set.at(pair);
+      Assert(snapshot.get_partitioner() == solution->get_partitioner(),
+             dealii::ExcMessage("The grid has changed since the snapshot was saved."));
+      solution->copy_locally_owned_data_from(snapshot);
+    }
+  update_ghosts();
+}
+
 #include "core/solution_handler.inst"
 
 PRISMS_PF_END_NAMESPACE
@@ -2,8 +2,13 @@
 // SPDX-License-Identifier: GNU Lesser General Public Version 2.1
 
 #include <deal.II/base/data_out_base.h>
+#include <deal.II/base/bounding_box.h>
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/utilities.h>
 #include <deal.II/dofs/dof_handler.h>
+#include <deal.II/grid/tria.h>
 #include <deal.II/numerics/data_component_interpretation.h>
 #include <deal.II/numerics/data_out.h>
 
@@ -14,12 +19,14 @@
 
 #include <prismspf/config.h>
 
+#include <cmath>
 #include <fstream>
 #include <iomanip>
 #include <map>
 #include <mpi.h>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 PRISMS_PF_BEGIN_NAMESPACE
@@ -31,12 +38,6 @@ SolutionOutput<dim, number>::SolutionOutput(const VectorType               &solu
                                             const std::string              &name,
                                             const UserInputParameters<dim> &user_inputs)
 {
-  // Some stuff to determine the actual name of the output file.
-  const auto n_trailing_digits = static_cast<unsigned int>(
-    std::floor(
-      std::log10(user_inputs.get_temporal_discretization().get_total_increments())) +
-    1);
-
   // Init data out
   dealii::DataOut<dim> data_out;
 
@@ -45,67 +46,15 @@ SolutionOutput<dim, number>::SolutionOutput(const VectorType               &solu
   // Add data vector
   data_out.add_data_vector(dof_handler, solution, name);
 
-  solution.zero_out_ghost_values();
-
-  // Build patches to linearly interpolate from higher order element degrees. Note that
-  // this essentially converts the element to an equal amount of subdivisions in the
-  // output. This does not make subdivisions and element degree equivalent in the
-  // simulation!
-  const unsigned int n_divisions =
-    user_inputs.get_output_parameters().get_patch_subdivisions() == 0
-      ? degree
-      : user_inputs.get_output_parameters().get_patch_subdivisions();
-  data_out.build_patches(n_divisions);
-
-  // Set some flags for data output
-  dealii::DataOutBase::VtkFlags flags;
-  flags.time                = user_inputs.get_temporal_discretization().get_time();
-  flags.cycle               = user_inputs.get_temporal_discretization().get_increment();
-  flags.print_date_and_time = true;
-#ifdef PRISMS_PF_WITH_ZLIB
-  // TODO (landinjm): Make this a user input parameter so they can select between
-  // compression levels. Best speed can be the default
-  flags.compression_level = dealii::DataOutBase::CompressionLevel::best_speed;
-#endif
-  data_out.set_flags(flags);
-
-  // Write to file based on the user input.
-  const std::string  directory = "./";
-  const unsigned int increment =
-    user_inputs.get_temporal_discretization().get_increment();
-
-  if (user_inputs.get_output_parameters().get_file_type() == "vtu")
-    {
-      std::ostringstream increment_stream;
-      increment_stream << std::setw(n_trailing_digits) << std::setfill('0') << increment;
-      const std::string filename =
-        directory + name + "_" + increment_stream.str() + ".vtu";
-      data_out.write_vtu_in_parallel(filename, MPI_COMM_WORLD);
-    }
-  else if (user_inputs.get_output_parameters().get_file_type() == "pvtu")
-    {
-      data_out.write_vtu_with_pvtu_record(directory,
-                                          name,
-                                          increment,
-                                          MPI_COMM_WORLD,
-                                          n_trailing_digits);
-    }
-  else if (user_inputs.get_output_parameters().get_file_type() == "vtk")
-    {
-      std::ostringstream increment_stream;
-      increment_stream << std::setw(n_trailing_digits) << std::setfill('0') << increment;
-      const std::string filename =
-        directory + name + "_" + increment_stream.str() + ".vtk";
-      std::ofstream vtk_output(filename);
-      data_out.write_vtk(vtk_output);
-    }
-  else
-    {
-      AssertThrow(false, UnreachableCode());
-    }
-
-  // Update the ghost values again to allow for read access
-  solution.update_ghost_values();
+  write_patches(data_out,
+                degree,
+                name,
+                user_inputs.get_temporal_discretization().get_increment(),
+                user_inputs.get_temporal_discretization().get_time(),
+                dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD),
+                dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD),
+                true,
+                user_inputs);
 }
 
 template <unsigned int dim, typename number>
@@ -114,22 +63,50 @@ SolutionOutput<dim, number>::SolutionOutput(
   const std::vector<const dealii::DoFHandler<dim> *> &dof_handlers,
   const unsigned int                                 &degree,
   const std::string                                  &name,
-  const UserInputParameters<dim>                     &user_inputs)
+  const UserInputParameters<dim>                     &user_inputs,
+  XDMFRecord                                         *xdmf_record)
 {
-  // Some stuff to determine the actual name of the output file.
-  const auto n_trailing_digits = static_cast<unsigned int>(
-    std::floor(
-      std::log10(user_inputs.get_temporal_discretization().get_total_increments())) +
-    1);
-
   // Init data out
   dealii::DataOut<dim> data_out;
 
   // Add data vectors
   for (const auto &[index, variable] : user_inputs.get_variable_attributes())
     {
-      auto *solution = solution_set.at(index);
-      solution->update_ghost_values();
+      solution_set.at(index)->update_ghost_values();
+    }
+  add_data_vectors(data_out, solution_set, dof_handlers, user_inputs);
+
+  write_patches(data_out,
+                degree,
+                name,
+                user_inputs.get_temporal_discretization().get_increment(),
+                user_inputs.get_temporal_discretization().get_time(),
+                dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD),
+                dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD),
+                true,
+                user_inputs,
+                xdmf_record);
+}
+
+template <unsigned int dim, typename number>
+void
+SolutionOutput<dim, number>::add_data_vectors(
+  dealii::DataOut<dim>                               &data_out,
+  const std::map<unsigned int, VectorType *>         &solution_set,
+  const std::vector<const dealii::DoFHandler<dim> *> &dof_handlers,
+  const UserInputParameters<dim>                     &user_inputs)
+{
+  const auto &output_parameters = user_inputs.get_output_parameters();
+
+  for (const auto &[index, variable] : user_inputs.get_variable_attributes())
+    {
+      // Skip the fields that are not selected for output
+      if (!output_parameters.should_output_field(variable))
+        {
+          continue;
+        }
+
+      const auto *solution = solution_set.at(index);
 
       // Mark field as Scalar/Vector
       const bool         is_scalar    = variable.get_field_type() == FieldType::Scalar;
@@ -144,9 +121,56 @@ SolutionOutput<dim, number>::SolutionOutput(
       const std::vector<std::string> names(n_components, variable.get_name());
 
       data_out.add_data_vector(*(dof_handlers.at(index)), *solution, names, data_type);
+    }
 
-      solution->zero_out_ghost_values();
+  // Only write the cells that intersect the region of interest
+  if (output_parameters.has_output_region())
+    {
+      const auto        &lower = output_parameters.get_region_lower_corner();
+      const auto        &upper = output_parameters.get_region_upper_corner();
+      dealii::Point<dim> lower_corner;
+      dealii::Point<dim> upper_corner;
+      for (unsigned int direction = 0; direction < dim; ++direction)
+        {
+          lower_corner[direction] = lower[direction];
+          upper_corner[direction] = upper[direction];
+        }
+      const dealii::BoundingBox<dim> region(std::make_pair(lower_corner, upper_corner));
+
+      data_out.set_cell_selection(
+        [region](const typename dealii::Triangulation<dim>::cell_iterator &cell)
+        {
+          return cell->is_active() && cell->is_locally_owned() &&
+                 region.get_neighbor_type(cell->bounding_box()) !=
+                   dealii::NeighborType::not_neighbors;
+        });
     }
+}
+
+template <unsigned int dim, typename number>
+void
+SolutionOutput<dim, number>::write_patches(
+  dealii::DataOut<dim>           &data_out,
+  const unsigned int             &degree,
+  const std::string              &name,
+  const unsigned int             &increment,
+  const double                   &time,
+  const unsigned int             &mpi_rank,
+  const unsigned int             &n_mpi_processes,
+  const bool                     &collective,
+  const UserInputParameters<dim> &user_inputs,
+  XDMFRecord                     *xdmf_record)
+{
+  Assert(collective || user_inputs.get_output_parameters().get_file_type() == "pvtu" ||
+           user_inputs.get_output_parameters().get_file_type() == "vtk",
+         dealii::ExcMessage("Only the pvtu and vtk file types can be written by a "
+                            "single process."));
+
+  // Some stuff to determine the actual name of the output file.
+  const auto n_trailing_digits = static_cast<unsigned int>(
+    std::floor(
+      std::log10(user_inputs.get_temporal_discretization().get_total_increments())) +
+    1);
 
   // Build patches to linearly interpolate from higher order element degrees. Note that
   // this essentially converts the element to an equal amount of subdivisions in the
@@ -160,28 +184,31 @@ SolutionOutput<dim, number>::SolutionOutput(
 
   // Set some flags for data output
   dealii::DataOutBase::VtkFlags flags;
-  flags.time                = user_inputs.get_temporal_discretization().get_time();
-  flags.cycle               = user_inputs.get_temporal_discretization().get_increment();
+  flags.time                = time;
+  flags.cycle               = increment;
   flags.print_date_and_time = true;
+  // Write each cell as a single Lagrange cell of order n_divisions, rather than as
+  // n_divisions^dim linear subcells
+  flags.write_higher_order_cells =
+    user_inputs.get_output_parameters().get_write_higher_order_cells();
 #ifdef PRISMS_PF_WITH_ZLIB
-  flags.compression_level = dealii::DataOutBase::CompressionLevel::best_speed;
+  flags.compression_level = user_inputs.get_output_parameters().get_compression_level();
 #endif
   data_out.set_flags(flags);
 
   // Write to file based on the user input.
-  const std::string  directory = "./";
-  const unsigned int increment =
-    user_inputs.get_temporal_discretization().get_increment();
+  const std::string directory = "./";
+
+  std::ostringstream increment_stream;
+  increment_stream << std::setw(n_trailing_digits) << std::setfill('0') << increment;
+  const std::string base_name = name + "_" + increment_stream.str();
 
   if (user_inputs.get_output_parameters().get_file_type() == "vtu")
     {
-      std::ostringstream increment_stream;
-      increment_stream << std::setw(n_trailing_digits) << std::setfill('0') << increment;
-      const std::string filename =
-        directory + name + "_" + increment_stream.str() + ".vtu";
+      const std::string filename = directory + base_name + ".vtu";
       data_out.write_vtu_in_parallel(filename, MPI_COMM_WORLD);
     }
-  else if (user_inputs.get_output_parameters().get_file_type() == "pvtu")
+  else if (user_inputs.get_output_parameters().get_file_type() == "pvtu" && collective)
     {
       data_out.write_vtu_with_pvtu_record(directory,
                                           name,
@@ -189,25 +216,82 @@ SolutionOutput<dim, number>::SolutionOutput(
                                           MPI_COMM_WORLD,
                                           n_trailing_digits);
     }
+  else if (user_inputs.get_output_parameters().get_file_type() == "pvtu")
+    {
+      // Each process writes its own piece and the first process writes the record. This
+      // follows the naming of DataOut::write_vtu_with_pvtu_record() without any
+      // communication.
+      const auto piece_name = [&](unsigned int rank)
+      {
+        return base_name + "." + dealii::Utilities::int_to_string(rank, 4) + ".vtu";
+      };
+
+      const std::string vtu_filename = directory + piece_name(mpi_rank);
+      std::ofstream     vtu_output(vtu_filename);
+      AssertThrow(vtu_output.is_open(), dealii::ExcFileNotOpen(vtu_filename));
+      data_out.write_vtu(vtu_output);
+
+      if (mpi_rank == 0)
+        {
+          std::vector<std::string> piece_names;
+          for (unsigned int rank = 0; rank < n_mpi_processes; ++rank)
+            {
+              piece_names.push_back(piece_name(rank));
+            }
+          const std::string pvtu_filename = directory + base_name + ".pvtu";
+          std::ofstream     pvtu_output(pvtu_filename);
+          AssertThrow(pvtu_output.is_open(), dealii::ExcFileNotOpen(pvtu_filename));
+          data_out.write_pvtu_record(pvtu_output, piece_names);
+        }
+    }
   else if (user_inputs.get_output_parameters().get_file_type() == "vtk")
     {
-      std::ostringstream increment_stream;
-      increment_stream << std::setw(n_trailing_digits) << std::setfill('0') << increment;
-      const std::string filename =
-        directory + name + "_" + increment_stream.str() + ".vtk";
-      std::ofstream vtk_output(filename);
+      const std::string filename = directory + base_name + ".vtk";
+      std::ofstream     vtk_output(filename);
+      AssertThrow(vtk_output.is_open(), dealii::ExcFileNotOpen(filename));
       data_out.write_vtk(vtk_output);
     }
-  else
+#ifdef PRISMS_PF_WITH_HDF5
+  else if (user_inputs.get_output_parameters().get_file_type() == "hdf5")
     {
-      AssertThrow(false, UnreachableCode());
-    }
+      Assert(xdmf_record != nullptr, dealii::ExcNotInitialized());
 
-  // Update the ghost values again to allow for read access
-  for (const auto &[index, variable] : user_inputs.get_variable_attributes())
+      // Merge the duplicate vertices of neighboring cells
+      dealii::DataOutBase::DataOutFilter data_filter(
+        dealii::DataOutBase::DataOutFilterFlags(true, true));
+      data_out.write_filtered_data(data_filter);
+
+      // Only write the mesh if it changed since the last output
+      const bool write_mesh = xdmf_record->mesh_changed;
+      if (write_mesh)
+        {
+          xdmf_record->mesh_filename = name + "_mesh_" + increment_stream.str() + ".h5";
+        }
+      const std::string solution_filename = base_name + ".h5";
+
+      // All processes write to one shared file with collective IO
+      data_out.write_hdf5_parallel(data_filter,
+                                   write_mesh,
+                                   directory + xdmf_record->mesh_filename,
+                                   directory + solution_filename,
+                                   MPI_COMM_WORLD);
+      xdmf_record->mesh_changed = false;
+
+      // Rewrite the XDMF file so it indexes every step written so far
+      xdmf_record->entries.push_back(
+        data_out.create_xdmf_entry(data_filter,
+                                   xdmf_record->mesh_filename,
+                                   solution_filename,
+                                   time,
+                                   MPI_COMM_WORLD));
+      data_out.write_xdmf_file(xdmf_record->entries,
+                               directory + name + ".xdmf",
+                               MPI_COMM_WORLD);
+    }
+#endif
+  else
     {
-      auto *solution = solution_set.at(index);
-      solution->update_ghost_values();
+      AssertThrow(false, UnreachableCode());
     }
 }
 
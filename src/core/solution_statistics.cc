@@ -0,0 +1,552 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/lac/vector.h>
+#include <deal.II/matrix_free/evaluation_flags.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <prismspf/core/conditional_ostreams.h>
+#include <prismspf/core/solution_statistics.h>
+#include <prismspf/core/type_enums.h>
+
+#include <prismspf/user_inputs/user_input_parameters.h>
+
+#include <prismspf/utilities/integrator.h>
+
+#include <prismspf/config.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mpi.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  // The file of the statistics time series
+  const std::string statistics_log_filename = "statistics.csv";
+
+  // The suffixes of the components of vector fields
+  const std::array<std::string, 3> component_suffixes = {
+    {"_x", "_y", "_z"}
+  };
+
+  // The number of values of a field in the slots of a cell batch. These are the min, the
+  // max, the volume of the phase, and the interface area.
+  constexpr unsigned int n_field_values = 4;
+} // namespace
+
+template <unsigned int dim, unsigned int degree, typename number>
+SolutionStatistics<dim, degree, number>::SolutionStatistics(
+  const UserInputParameters<dim> &_user_inputs)
+  : user_inputs(&_user_inputs)
+{}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+SolutionStatistics<dim, degree, number>::compute(
+  const std::shared_ptr<dealii::MatrixFree<dim, number, SizeType>> &data,
+  const std::map<unsigned int, VectorType *>                       &solution_set)
+{
+  statistics.clear();
+  if (solution_set.empty())
+    {
+      return;
+    }
+
+  const auto &output_parameters = user_inputs->get_output_parameters();
+  const bool  compute_l2_norm   = output_parameters.has_statistic("l2 norm");
+  const bool  compute_interface_area =
+    output_parameters.has_statistic("interface area");
+  const bool compute_integrals = output_parameters.has_statistic("integral") ||
+                                 output_parameters.has_statistic("mean");
+  const bool compute_cell_values =
+    compute_interface_area || output_parameters.has_statistic("mean") ||
+    output_parameters.has_statistic("min") || output_parameters.has_statistic("max") ||
+    output_parameters.has_statistic("phase fraction");
+  const auto threshold =
+    static_cast<number>(output_parameters.get_phase_fraction_threshold());
+
+  // Lay out the values of each field in the slots of a cell batch. The first slot is the
+  // volume of the cells, then each field has the min, the max, the volume of the phase,
+  // and the interface area.
+  std::map<unsigned int, unsigned int> n_components;
+  std::map<unsigned int, unsigned int> offsets;
+  unsigned int                         n_values_per_batch = 1;
+  for (const auto &[index, solution] : solution_set)
+    {
+      n_components[index] =
+        user_inputs->get_variable_attributes().at(index).get_field_type() ==
+            FieldType::Vector
+          ? dim
+          : 1;
+      offsets[index] = n_values_per_batch;
+      n_values_per_batch += n_field_values;
+    }
+
+  // The integrals of all fields are reduced by the integrator
+  std::map<unsigned int, std::vector<double>> integrals;
+  if (compute_integrals)
+    {
+      integrator.initialize(data);
+      integrator.compute_integrals(integrals, solution_set);
+    }
+
+  // Evaluate the cell volumes and the extrema of all fields in one pass over the cells
+  dealii::Vector<double> batch_values;
+  if (compute_cell_values)
+    {
+      batch_values.reinit(data->n_cell_batches() * n_values_per_batch);
+
+      std::vector<VectorType *> src;
+      for (const auto &[index, solution] : solution_set)
+        {
+          src.push_back(solution);
+        }
+
+      const auto local_accumulate =
+        [&](const dealii::MatrixFree<dim, number, SizeType> &matrix_free,
+            dealii::Vector<double>                          &dst,
+            const std::vector<VectorType *>                 &solutions,
+            const std::pair<unsigned int, unsigned int>     &cell_range)
+      {
+        accumulate_cell_volumes(matrix_free, n_values_per_batch, dst, cell_range);
+
+        unsigned int field = 0;
+        for (const auto &[index, offset] : offsets)
+          {
+            if (n_components.at(index) == 1)
+              {
+                accumulate_cell_batches<1>(matrix_free,
+                                           index,
+                                           *solutions[field],
+                                           offset,
+                                           n_values_per_batch,
+                                           compute_interface_area,
+                                           threshold,
+                                           dst,
+                                           cell_range);
+              }
+            else
+              {
+                accumulate_cell_batches<dim>(matrix_free,
+                                             index,
+                                             *solutions[field],
+                                             offset,
+                                             n_values_per_batch,
+                                             false,
+                                             threshold,
+                                             dst,
+                                             cell_range);
+              }
+            field++;
+          }
+      };
+
+      data->template cell_loop<dealii::Vector<double>, std::vector<VectorType *>>(
+        local_accumulate,
+        batch_values,
+        src);
+    }
+
+  // Combine the cell batches of this process. The volume comes first, then each field
+  // has the sum of squares of the solution vector, the min, the max, the volume of the
+  // phase, and the interface area.
+  const unsigned int  n_batches = batch_values.size() / n_values_per_batch;
+  std::vector<double> local_values(1, 0.0);
+  for (unsigned int batch = 0; batch < n_batches; ++batch)
+    {
+      local_values[0] += batch_values[batch * n_values_per_batch];
+    }
+  for (const auto &[index, solution] : solution_set)
+    {
+      const unsigned int offset = offsets.at(index);
+
+      double min            = std::numeric_limits<double>::max();
+      double max            = std::numeric_limits<double>::lowest();
+      double phase_volume   = 0.0;
+      double interface_area = 0.0;
+      for (unsigned int batch = 0; batch < n_batches; ++batch)
+        {
+          const unsigned int batch_offset = (batch * n_values_per_batch) + offset;
+          min = std::min(min, batch_values[batch_offset]);
+          max = std::max(max, batch_values[batch_offset + 1]);
+          phase_volume += batch_values[batch_offset + 2];
+          interface_area += batch_values[batch_offset + 3];
+        }
+
+      double sum_of_squares = 0.0;
+      if (compute_l2_norm)
+        {
+          for (const number value : *solution)
+            {
+              sum_of_squares += static_cast<double>(value) * value;
+            }
+        }
+
+      local_values.push_back(sum_of_squares);
+      local_values.push_back(min);
+      local_values.push_back(max);
+      local_values.push_back(phase_volume);
+      local_values.push_back(interface_area);
+    }
+
+  // Reduce the values of all fields at once. Each value is summed, minimized, and
+  // maximized, and the relevant one is kept.
+  const auto reduced_values =
+    dealii::Utilities::MPI::min_max_avg(local_values, MPI_COMM_WORLD);
+
+  const double volume      = reduced_values[0].sum;
+  unsigned int value_index = 1;
+  for (const auto &[index, solution] : solution_set)
+    {
+      FieldStatistics &field_statistics = statistics[index];
+      if (compute_integrals)
+        {
+          field_statistics.integral = integrals.at(index);
+        }
+      else
+        {
+          field_statistics.integral.assign(n_components.at(index), 0.0);
+        }
+      for (const double &integral : field_statistics.integral)
+        {
+          field_statistics.mean.push_back(volume > 0.0 ? integral / volume : 0.0);
+        }
+      field_statistics.l2_norm = std::sqrt(reduced_values[value_index++].sum);
+      field_statistics.min     = reduced_values[value_index++].min;
+      field_statistics.max     = reduced_values[value_index++].max;
+      const double phase_volume = reduced_values[value_index++].sum;
+      field_statistics.phase_fraction = volume > 0.0 ? phase_volume / volume : 0.0;
+      field_statistics.interface_area = reduced_values[value_index++].sum;
+    }
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+SolutionStatistics<dim, degree, number>::print() const
+{
+  const auto &output_parameters = user_inputs->get_output_parameters();
+
+  ConditionalOStreams::pout_base()
+    << "Iteration: " << user_inputs->get_temporal_discretization().get_increment()
+    << "\n";
+  for (const auto &[index, field_statistics] : statistics)
+    {
+      ConditionalOStreams::pout_base() << "  Solution index " << index;
+      if (output_parameters.has_statistic("l2 norm"))
+        {
+          ConditionalOStreams::pout_base() << " l2-norm: " << field_statistics.l2_norm;
+        }
+      if (output_parameters.has_statistic("integral"))
+        {
+          ConditionalOStreams::pout_base() << " integrated value: ";
+          if (field_statistics.integral.size() == 1)
+            {
+              ConditionalOStreams::pout_base() << field_statistics.integral[0];
+            }
+          else
+            {
+              for (const double &value : field_statistics.integral)
+                {
+                  ConditionalOStreams::pout_base() << value << " ";
+                }
+            }
+        }
+      if (output_parameters.has_statistic("mean"))
+        {
+          ConditionalOStreams::pout_base() << " mean: ";
+          if (field_statistics.mean.size() == 1)
+            {
+              ConditionalOStreams::pout_base() << field_statistics.mean[0];
+            }
+          else
+            {
+              for (const double &value : field_statistics.mean)
+                {
+                  ConditionalOStreams::pout_base() << value << " ";
+                }
+            }
+        }
+      if (output_parameters.has_statistic("min"))
+        {
+          ConditionalOStreams::pout_base() << " min: " << field_statistics.min;
+        }
+      if (output_parameters.has_statistic("max"))
+        {
+          ConditionalOStreams::pout_base() << " max: " << field_statistics.max;
+        }
+      if (field_statistics.integral.size() == 1)
+        {
+          if (output_parameters.has_statistic("phase fraction"))
+            {
+              ConditionalOStreams::pout_base()
+                << " phase fraction: " << field_statistics.phase_fraction;
+            }
+          if (output_parameters.has_statistic("interface area"))
+            {
+              ConditionalOStreams::pout_base()
+                << " interface area: " << field_statistics.interface_area;
+            }
+        }
+      ConditionalOStreams::pout_base() << "\n";
+    }
+  for (const auto &[name, value] : reductions)
+    {
+      ConditionalOStreams::pout_base() << "  Reduction " << name << ": " << value << "\n";
+    }
+  ConditionalOStreams::pout_base() << "\n" << std::flush;
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+SolutionStatistics<dim, degree, number>::write_log() const
+{
+  if (dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) != 0)
+    {
+      return;
+    }
+
+  const auto &output_parameters = user_inputs->get_output_parameters();
+
+  // Write the header if the log is new. A restarted simulation appends to the existing
+  // log.
+  const bool    new_log = !std::filesystem::exists(statistics_log_filename);
+  std::ofstream log(statistics_log_filename, std::ios::app);
+  if (new_log)
+    {
+      log << "increment,time";
+      for (const auto &[index, field_statistics] : statistics)
+        {
+          const std::string &name =
+            user_inputs->get_variable_attributes().at(index).get_name();
+          if (output_parameters.has_statistic("integral"))
+            {
+              for (unsigned int component = 0;
+                   component < field_statistics.integral.size();
+                   ++component)
+                {
+                  log << "," << name << "_integral"
+                      << (field_statistics.integral.size() == 1
+                            ? ""
+                            : component_suffixes[component]);
+                }
+            }
+          if (output_parameters.has_statistic("l2 norm"))
+            {
+              log << "," << name << "_l2_norm";
+            }
+          if (output_parameters.has_statistic("mean"))
+            {
+              for (unsigned int component = 0; component < field_statistics.mean.size();
+                   ++component)
+                {
+                  log << "," << name << "_mean"
+                      << (field_statistics.mean.size() == 1
+                            ? ""
+                            : component_suffixes[component]);
+                }
+            }
+          if (output_parameters.has_statistic("min"))
+            {
+              log << "," << name << "_min";
+            }
+          if (output_parameters.has_statistic("max"))
+            {
+              log << "," << name << "_max";
+            }
+          if (field_statistics.integral.size() == 1)
+            {
+              if (output_parameters.has_statistic("phase fraction"))
+                {
+                  log << "," << name << "_phase_fraction";
+                }
+              if (output_parameters.has_statistic("interface area"))
+                {
+                  log << "," << name << "_interface_area";
+                }
+            }
+        }
+      for (const auto &[name, value] : reductions)
+        {
+          log << "," << name;
+        }
+      log << "\n";
+    }
+
+  log << std::setprecision(std::numeric_limits<double>::max_digits10)
+      << user_inputs->get_temporal_discretization().get_increment() << ","
+      << user_inputs->get_temporal_discretization().get_time();
+  for (const auto &[index, field_statistics] : statistics)
+    {
+      if (output_parameters.has_statistic("integral"))
+        {
+          for (const double &value : field_statistics.integral)
+            {
+              log << "," << value;
+            }
+        }
+      if (output_parameters.has_statistic("l2 norm"))
+        {
+          log << "," << field_statistics.l2_norm;
+        }
+      if (output_parameters.has_statistic("mean"))
+        {
+          for (const double &value : field_statistics.mean)
+            {
+              log << "," << value;
+            }
+        }
+      if (output_parameters.has_statistic("min"))
+        {
+          log << "," << field_statistics.min;
+        }
+      if (output_parameters.has_statistic("max"))
+        {
+          log << "," << field_statistics.max;
+        }
+      if (field_statistics.integral.size() == 1)
+        {
+          if (output_parameters.has_statistic("phase fraction"))
+            {
+              log << "," << field_statistics.phase_fraction;
+            }
+          if (output_parameters.has_statistic("interface area"))
+            {
+              log << "," << field_statistics.interface_area;
+            }
+        }
+    }
+  for (const auto &[name, value] : reductions)
+    {
+      log << "," << value;
+    }
+  log << "\n";
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+SolutionStatistics<dim, degree, number>::accumulate_cell_volumes(
+  const dealii::MatrixFree<dim, number, SizeType> &data,
+  unsigned int                                     n_values_per_batch,
+  dealii::Vector<double>                          &batch_values,
+  const std::pair<unsigned int, unsigned int>     &cell_range) const
+{
+  dealii::FEEvaluation<dim, degree, degree + 1, 1, number> fe_eval(data);
+
+  for (unsigned int batch = cell_range.first; batch < cell_range.second; ++batch)
+    {
+      fe_eval.reinit(batch);
+
+      SizeType volume(0.0);
+      for (const unsigned int q_point : fe_eval.quadrature_point_indices())
+        {
+          volume += fe_eval.JxW(q_point);
+        }
+
+      for (unsigned int lane = 0; lane < data.n_active_entries_per_cell_batch(batch);
+           ++lane)
+        {
+          batch_values[batch * n_values_per_batch] += volume[lane];
+        }
+    }
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+template <unsigned int n_components>
+void
+SolutionStatistics<dim, degree, number>::accumulate_cell_batches(
+  const dealii::MatrixFree<dim, number, SizeType> &data,
+  unsigned int                                     index,
+  const VectorType                                &solution,
+  unsigned int                                     offset,
+  unsigned int                                     n_values_per_batch,
+  bool                                             compute_interface_area,
+  number                                           threshold,
+  dealii::Vector<double>                          &batch_values,
+  const std::pair<unsigned int, unsigned int>     &cell_range) const
+{
+  dealii::FEEvaluation<dim, degree, degree + 1, n_components, number> fe_eval(data,
+                                                                              index);
+  const dealii::EvaluationFlags::EvaluationFlags flags =
+    compute_interface_area
+      ? dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients
+      : dealii::EvaluationFlags::values;
+
+  for (unsigned int batch = cell_range.first; batch < cell_range.second; ++batch)
+    {
+      fe_eval.reinit(batch);
+      fe_eval.read_dof_values_plain(solution);
+      fe_eval.evaluate(flags);
+
+      // Accumulate over the quadrature points of every lane at once
+      SizeType min(std::numeric_limits<number>::max());
+      SizeType max(std::numeric_limits<number>::lowest());
+      SizeType phase_volume(0.0);
+      SizeType interface_area(0.0);
+      for (const unsigned int q_point : fe_eval.quadrature_point_indices())
+        {
+          const auto value = fe_eval.get_value(q_point);
+          SizeType   magnitude;
+          if constexpr (n_components == 1)
+            {
+              magnitude = value;
+
+              // The phase is where the field exceeds the threshold
+              phase_volume +=
+                dealii::compare_and_apply_mask<dealii::SIMDComparison::greater_than>(
+                  value,
+                  SizeType(threshold),
+                  fe_eval.JxW(q_point),
+                  SizeType(0.0));
+
+              // By the coarea formula, the integral of the gradient magnitude is the
+              // area of the level sets between the bounds of the field
+              if (compute_interface_area)
+                {
+                  interface_area += fe_eval.get_gradient(q_point).norm() *
+                                    fe_eval.JxW(q_point);
+                }
+            }
+          else
+            {
+              magnitude = value.norm();
+            }
+          min = std::min(min, magnitude);
+          max = std::max(max, magnitude);
+        }
+
+      // Combine the lanes that hold cells
+      const unsigned int batch_offset = (batch * n_values_per_batch) + offset;
+      double             batch_min    = std::numeric_limits<double>::max();
+      double             batch_max    = std::numeric_limits<double>::lowest();
+      for (unsigned int lane = 0; lane < data.n_active_entries_per_cell_batch(batch);
+           ++lane)
+        {
+          batch_min = std::min(batch_min, static_cast<double>(min[lane]));
+          batch_max = std::max(batch_max, static_cast<double>(max[lane]));
+          batch_values[batch_offset + 2] += phase_volume[lane];
+          batch_values[batch_offset + 3] += interface_area[lane];
+        }
+      batch_values[batch_offset]     = batch_min;
+      batch_values[batch_offset + 1] = batch_max;
+    }
+}
+
+#include "core/solution_statistics.inst"
+
+PRISMS_PF_END_NAMESPACE
@@ -12,6 +12,7 @@
 
 #include <prismspf/config.h>
 
+#include <map>
 #include <ostream>
 #include <string>
 
@@ -20,6 +21,9 @@ PRISMS_PF_BEGIN_NAMESPACE
 template <unsigned int dim, unsigned int degree, typename number>
 SolverHandler<dim, degree, number>::SolverHandler(
   const SolverContext<dim, degree, number> &_solver_context)
+  : use_monolithic_solve(_solver_context.get_user_inputs()
+                           .get_nonlinear_solve_parameters()
+                           .get_use_monolithic_solve())
 {
   // Create a set of the solve blocks
   for (const auto &[index, variable] :
@@ -41,9 +45,18 @@ SolverHandler<dim, degree, number>::SolverHandler(
       sequential_self_nonlinear_solver.try_emplace(solve_block,
                                                    _solver_context,
                                                    solve_block);
-      sequential_co_nonlinear_solver.try_emplace(solve_block,
-                                                 _solver_context,
-                                                 solve_block);
+      if (use_monolithic_solve)
+        {
+          monolithic_co_nonlinear_solver.try_emplace(solve_block,
+                                                     _solver_context,
+                                                     solve_block);
+        }
+      else
+        {
+          sequential_co_nonlinear_solver.try_emplace(solve_block,
+                                                     _solver_context,
+                                                     solve_block);
+        }
     }
 }
 
@@ -89,10 +102,20 @@ SolverHandler<dim, degree, number>::init()
         << std::flush;
       sequential_self_nonlinear_solver.at(solve_block).init();
 
-      ConditionalOStreams::pout_base()
-        << "  trying to initialize sequential co-nonlinear solvers...\n"
-        << std::flush;
-      sequential_co_nonlinear_solver.at(solve_block).init();
+      if (use_monolithic_solve)
+        {
+          ConditionalOStreams::pout_base()
+            << "  trying to initialize monolithic co-nonlinear solvers...\n"
+            << std::flush;
+          monolithic_co_nonlinear_solver.at(solve_block).init();
+        }
+      else
+        {
+          ConditionalOStreams::pout_base()
+            << "  trying to initialize sequential co-nonlinear solvers...\n"
+            << std::flush;
+          sequential_co_nonlinear_solver.at(solve_block).init();
+        }
     }
 
   Timer::end_section("Solver initialization");
@@ -118,7 +141,14 @@ SolverHandler<dim, degree, number>::reinit()
 
       sequential_self_nonlinear_solver.at(solve_block).reinit();
 
-      sequential_co_nonlinear_solver.at(solve_block).reinit();
+      if (use_monolithic_solve)
+        {
+          monolithic_co_nonlinear_solver.at(solve_block).reinit();
+        }
+      else
+        {
+          sequential_co_nonlinear_solver.at(solve_block).reinit();
+        }
     }
 
   Timer::end_section("Solver reinitialization");
@@ -165,7 +195,14 @@ SolverHandler<dim, degree, number>::solve(unsigned int increment,
             << "  solving co-nonlinear time-independent variables...\n"
             << std::flush;
           Timer::start_section("Nonexplicit co-nonlinear solver");
-          sequential_co_nonlinear_solver.at(solve_block).solve();
+          if (use_monolithic_solve)
+            {
+              monolithic_co_nonlinear_solver.at(solve_block).solve();
+            }
+          else
+            {
+              sequential_co_nonlinear_solver.at(solve_block).solve();
+            }
           Timer::end_section("Nonexplicit co-nonlinear solver");
 
           if (update_postprocessed)
@@ -200,7 +237,14 @@ SolverHandler<dim, degree, number>::solve(unsigned int increment,
       Timer::end_section("Nonexplicit self-nonlinear solver");
 
       Timer::start_section("Nonexplicit co-nonlinear solver");
-      sequential_co_nonlinear_solver.at(solve_block).solve();
+      if (use_monolithic_solve)
+        {
+          monolithic_co_nonlinear_solver.at(solve_block).solve();
+        }
+      else
+        {
+          sequential_co_nonlinear_solver.at(solve_block).solve();
+        }
       Timer::end_section("Nonexplicit co-nonlinear solver");
 
       if (update_postprocessed)
@@ -212,6 +256,19 @@ SolverHandler<dim, degree, number>::solve(unsigned int increment,
     };
 }
 
+template <unsigned int dim, unsigned int degree, typename number>
+std::map<std::string, double>
+SolverHandler<dim, degree, number>::get_reductions()
+{
+  std::map<std::string, double> reductions;
+  for (const auto &solve_block : solve_blocks)
+    {
+      reductions.merge(
+        concurrent_explicit_postprocess_solver.at(solve_block).get_reductions());
+    }
+  return reductions;
+}
+
 #include "core/solver_handler.inst"
 
 PRISMS_PF_END_NAMESPACE
@@ -3,17 +3,23 @@
 
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/point.h>
+#include <deal.II/distributed/grid_refinement.h>
 #include <deal.II/distributed/tria.h>
 #include <deal.II/grid/grid_generator.h>
 #include <deal.II/grid/grid_out.h>
 #include <deal.II/grid/grid_refinement.h>
+#include <deal.II/grid/cell_status.h>
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_accessor.h>
+#include <deal.II/lac/vector.h>
 #include <deal.II/multigrid/mg_transfer_global_coarsening.h>
 
 #include <prismspf/core/conditional_ostreams.h>
+#include <prismspf/core/exceptions.h>
+#include <prismspf/core/grid_refiner_criterion.h>
 #include <prismspf/core/multigrid_info.h>
 #include <prismspf/core/triangulation_handler.h>
 
@@ -24,6 +30,7 @@
 
 #include <cmath>
 #include <fstream>
+#include <functional>
 #include <memory>
 #include <mpi.h>
 #include <vector>
@@ -43,9 +50,19 @@ TriangulationHandler<dim>::TriangulationHandler(
     }
   else
     {
+      // When the cells are weighted, we only repartition when the load imbalance is
+      // large enough so we turn off the repartitioning on every refinement. The grid
+      // refiner then balances the load, or the number of cells until the load is known.
+      const auto settings =
+        _user_inputs.get_spatial_discretization().get_cell_weighting() ==
+            GridRefinement::Uniform
+          ? Triangulation::Settings::default_setting
+          : Triangulation::Settings::no_automatic_repartitioning;
+
       triangulation = std::make_shared<Triangulation>(
         MPI_COMM_WORLD,
-        dealii::Triangulation<dim>::limit_level_difference_at_vertices);
+        dealii::Triangulation<dim>::limit_level_difference_at_vertices,
+        settings);
     }
 
   has_multigrid = mg_info.has_multigrid();
@@ -65,6 +82,129 @@ TriangulationHandler<dim>::get_triangulation() const
   return *triangulation;
 }
 
+template <unsigned int dim>
+void
+TriangulationHandler<dim>::refine_and_coarsen_fixed_fraction(
+  const dealii::Vector<float> &estimated_error,
+  double                       refine_fraction,
+  double                       coarsen_fraction)
+{
+  Assert(triangulation != nullptr, dealii::ExcNotInitialized());
+  Assert(estimated_error.size() == triangulation->n_active_cells(),
+         dealii::ExcDimensionMismatch(estimated_error.size(),
+                                      triangulation->n_active_cells()));
+
+  if constexpr (dim == 1)
+    {
+      dealii::GridRefinement::refine_and_coarsen_fixed_fraction(*triangulation,
+                                                                estimated_error,
+                                                                refine_fraction,
+                                                                coarsen_fraction);
+    }
+  else
+    {
+      dealii::parallel::distributed::GridRefinement::refine_and_coarsen_fixed_fraction(
+        *triangulation,
+        estimated_error,
+        refine_fraction,
+        coarsen_fraction);
+    }
+}
+
+template <unsigned int dim>
+void
+TriangulationHandler<dim>::refine_and_coarsen_fixed_number(
+  const dealii::Vector<float> &estimated_error,
+  double                       refine_fraction,
+  double                       coarsen_fraction,
+  unsigned int                 max_n_cells)
+{
+  Assert(triangulation != nullptr, dealii::ExcNotInitialized());
+  Assert(estimated_error.size() == triangulation->n_active_cells(),
+         dealii::ExcDimensionMismatch(estimated_error.size(),
+                                      triangulation->n_active_cells()));
+
+  if constexpr (dim == 1)
+    {
+      dealii::GridRefinement::refine_and_coarsen_fixed_number(*triangulation,
+                                                              estimated_error,
+                                                              refine_fraction,
+                                                              coarsen_fraction,
+                                                              max_n_cells);
+    }
+  else
+    {
+      dealii::parallel::distributed::GridRefinement::refine_and_coarsen_fixed_number(
+        *triangulation,
+        estimated_error,
+        refine_fraction,
+        coarsen_fraction,
+        max_n_cells);
+    }
+}
+
+template <unsigned int dim>
+bool
+TriangulationHandler<dim>::has_refinement_flags() const
+{
+  Assert(triangulation != nullptr, dealii::ExcNotInitialized());
+
+  bool is_flagged = false;
+  for (const auto &cell : triangulation->active_cell_iterators())
+    {
+      if (cell->is_locally_owned() &&
+          (cell->refine_flag_set() || cell->coarsen_flag_set()))
+        {
+          is_flagged = true;
+          break;
+        }
+    }
+
+  return dealii::Utilities::MPI::logical_or(is_flagged, MPI_COMM_WORLD);
+}
+
+template <unsigned int dim>
+void
+TriangulationHandler<dim>::set_cell_weight_function(const CellWeightFunction &cell_weight)
+{
+  Assert(triangulation != nullptr, dealii::ExcNotInitialized());
+
+  cell_weight_connection.disconnect();
+  cell_weight_connection = triangulation->signals.weight.connect(
+    [cell_weight](const CellIterator &cell, const dealii::CellStatus) -> unsigned int
+    {
+      return cell_weight(cell);
+    });
+}
+
+template <unsigned int dim>
+void
+TriangulationHandler<dim>::save(const std::string &filename) const
+{
+  Assert(triangulation != nullptr, dealii::ExcNotInitialized());
+
+  if constexpr (dim != 1)
+    {
+      triangulation->save(filename);
+    }
+  else
+    {
+      AssertThrow(false, FeatureNotImplemented("Checkpointing in 1D"));
+    }
+}
+
+template <unsigned int dim>
+void
+TriangulationHandler<dim>::repartition()
+{
+  Assert(triangulation != nullptr, dealii::ExcNotInitialized());
+
+  if constexpr (dim != 1)
+    {
+      triangulation->repartition();
+    }
+}
+
 template <unsigned int dim>
 const std::vector<std::shared_ptr<const dealii::Triangulation<dim>>> &
 TriangulationHandler<dim>::get_mg_triangulation() const
@@ -106,7 +246,7 @@ TriangulationHandler<dim>::get_mg_max_level() const
 
 template <unsigned int dim>
 void
-TriangulationHandler<dim>::generate_mesh()
+TriangulationHandler<dim>::generate_mesh(const std::string &checkpoint_filename)
 {
   // TODO (landinjm): Add more generality in selecting mesh types
   if (user_inputs->get_spatial_discretization().get_radius() != 0.0)
@@ -148,9 +288,20 @@ TriangulationHandler<dim>::generate_mesh()
   export_triangulation_as_vtk("triangulation");
 #endif
 
-  // Global refinement
-  triangulation->refine_global(
-    user_inputs->get_spatial_discretization().get_global_refinement());
+  // Global refinement, or load the refined mesh from the checkpoint
+  if (checkpoint_filename.empty())
+    {
+      triangulation->refine_global(
+        user_inputs->get_spatial_discretization().get_global_refinement());
+    }
+  else if constexpr (dim != 1)
+    {
+      triangulation->load(checkpoint_filename);
+    }
+  else
+    {
+      AssertThrow(false, FeatureNotImplemented("Checkpointing in 1D"));
+    }
 
   // Create the triangulations for the coarser levels if we have at least one instance of
   // multigrid for any of the fields
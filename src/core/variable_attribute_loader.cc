@@ -151,6 +151,13 @@ VariableAttributeLoader::set_is_postprocessed_field(const unsigned int &index,
   var_attributes[index].is_postprocessed_variable = is_postprocess;
 }
 
+void
+VariableAttributeLoader::set_is_output_field(const unsigned int &index,
+                                             const bool         &is_output)
+{
+  var_attributes[index].is_output_variable = is_output;
+}
+
 void
 VariableAttributeLoader::set_solve_block(const unsigned int &index,
                                          const Types::Index &solve_block)
@@ -281,6 +281,7 @@ VariableAttributes::print() const
     << "Variable type: " << to_string(field_type) << "\n"
     << "Equation type: " << to_string(pde_type) << "\n"
     << "Postprocessed field: " << bool_to_string(is_postprocessed_variable) << "\n"
+    << "Output field: " << bool_to_string(is_output_variable) << "\n"
     << "Field solve type: " << to_string(field_solve_type) << "\n";
 
   ConditionalOStreams::pout_summary() << "Evaluation flags RHS:\n";
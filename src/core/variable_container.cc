@@ -19,7 +19,9 @@
 #include <prismspf/config.h>
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <ranges>
@@ -42,6 +44,7 @@ VariableContainer<dim, degree, number>::VariableContainer(
   , element_volume_handler(&_element_volume)
   , global_to_local_solution(&_global_to_local_solution)
   , solve_type(_solve_type)
+  , matrix_free(&data)
 {
   // Grab some data from the VariableAttributes
   max_fields           = subset_attributes->begin()->second.get_max_fields();
@@ -142,8 +145,13 @@ VariableContainer<dim, degree, number>::eval_local_operator(
   const std::vector<VectorType *>             &src,
   const std::pair<unsigned int, unsigned int> &cell_range)
 {
+  const bool record_cost = element_volume_handler->records_cell_batch_cost();
+
   for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      const auto start = record_cost ? std::chrono::steady_clock::now()
+                                     : std::chrono::steady_clock::time_point();
+
       // Grab the element volume
       SizeType element_volume = element_volume_handler->get_element_volume(cell);
 
@@ -159,6 +167,21 @@ VariableContainer<dim, degree, number>::eval_local_operator(
 
       // Integrate and add to global vector dst
       integrate_and_distribute(dst);
+
+      // Combine the reductions of the cell batch
+      if (!cell_reductions.empty())
+        {
+          finalize_cell_reductions(cell);
+        }
+
+      // Record the cost of the cell batch
+      if (record_cost)
+        {
+          element_volume_handler->add_cell_batch_cost(
+            cell,
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+              .count());
+        }
     }
 }
 
@@ -172,8 +195,13 @@ VariableContainer<dim, degree, number>::eval_local_operator(
   const std::vector<VectorType *>             &src,
   const std::pair<unsigned int, unsigned int> &cell_range)
 {
+  const bool record_cost = element_volume_handler->records_cell_batch_cost();
+
   for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      const auto start = record_cost ? std::chrono::steady_clock::now()
+                                     : std::chrono::steady_clock::time_point();
+
       // Grab the element volume
       SizeType element_volume = element_volume_handler->get_element_volume(cell);
 
@@ -189,6 +217,15 @@ VariableContainer<dim, degree, number>::eval_local_operator(
 
       // Integrate and add to global vector dst
       integrate_and_distribute(dst);
+
+      // Record the cost of the cell batch
+      if (record_cost)
+        {
+          element_volume_handler->add_cell_batch_cost(
+            cell,
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+              .count());
+        }
     }
 }
 
@@ -203,8 +240,13 @@ VariableContainer<dim, degree, number>::eval_local_operator(
   const std::vector<VectorType *>             &src_subset,
   const std::pair<unsigned int, unsigned int> &cell_range)
 {
+  const bool record_cost = element_volume_handler->records_cell_batch_cost();
+
   for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      const auto start = record_cost ? std::chrono::steady_clock::now()
+                                     : std::chrono::steady_clock::time_point();
+
       // Grab the element volume
       SizeType element_volume = element_volume_handler->get_element_volume(cell);
 
@@ -221,6 +263,15 @@ VariableContainer<dim, degree, number>::eval_local_operator(
 
       // Integrate and add to global vector dst
       integrate_and_distribute(dst);
+
+      // Record the cost of the cell batch
+      if (record_cost)
+        {
+          element_volume_handler->add_cell_batch_cost(
+            cell,
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+              .count());
+        }
     }
 }
 
@@ -438,6 +489,90 @@ VariableContainer<dim, degree, number>::submission_valid(
 #endif
 }
 
+template <unsigned int dim, unsigned int degree, typename number>
+void
+VariableContainer<dim, degree, number>::add_reduction(const std::string &name,
+                                                      const SizeType    &value,
+                                                      ReductionType      type)
+{
+  Assert(solve_type == SolveType::Postprocess,
+         dealii::ExcMessage("Reductions can only be accumulated when computing "
+                            "postprocessed fields."));
+
+  auto [iterator, inserted] = cell_reductions.try_emplace(name, type, SizeType(0.0));
+  auto &[reduction_type, cell_value] = iterator->second;
+  Assert(reduction_type == type,
+         dealii::ExcMessage("The reduction " + name +
+                            " was accumulated with different types."));
+  if (inserted && type == ReductionType::Minimum)
+    {
+      cell_value = std::numeric_limits<number>::max();
+    }
+  else if (inserted && type == ReductionType::Maximum)
+    {
+      cell_value = std::numeric_limits<number>::lowest();
+    }
+
+  switch (type)
+    {
+      case ReductionType::Sum:
+        cell_value += value * get_jxw();
+        break;
+      case ReductionType::Minimum:
+        cell_value = std::min(cell_value, value);
+        break;
+      case ReductionType::Maximum:
+        cell_value = std::max(cell_value, value);
+        break;
+      default:
+        AssertThrow(false, UnreachableCode());
+    }
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+VariableContainer<dim, degree, number>::finalize_cell_reductions(unsigned int cell)
+{
+  const unsigned int n_lanes = matrix_free->n_active_entries_per_cell_batch(cell);
+  for (const auto &[name, cell_reduction] : cell_reductions)
+    {
+      const auto &[type, cell_value] = cell_reduction;
+
+      auto [iterator, inserted] = reductions.try_emplace(name, type, 0.0);
+      double &value             = iterator->second.second;
+      if (inserted && type == ReductionType::Minimum)
+        {
+          value = std::numeric_limits<double>::max();
+        }
+      else if (inserted && type == ReductionType::Maximum)
+        {
+          value = std::numeric_limits<double>::lowest();
+        }
+
+      for (unsigned int lane = 0; lane < n_lanes; ++lane)
+        {
+          const auto lane_value = static_cast<double>(cell_value[lane]);
+          switch (type)
+            {
+              case ReductionType::Sum:
+                value += lane_value;
+                break;
+              case ReductionType::Minimum:
+                value = std::min(value, lane_value);
+                break;
+              case ReductionType::Maximum:
+                value = std::max(value, lane_value);
+                break;
+              default:
+                AssertThrow(false, UnreachableCode());
+            }
+        }
+    }
+
+  // The next cell batch starts over
+  cell_reductions.clear();
+}
+
 template <unsigned int dim, unsigned int degree, typename number>
 unsigned int
 VariableContainer<dim, degree, number>::get_n_q_points() const
@@ -530,6 +665,48 @@ VariableContainer<dim, degree, number>::get_q_point_location() const
   return dealii::Point<dim, SizeType>();
 }
 
+template <unsigned int dim, unsigned int degree, typename number>
+typename VariableContainer<dim, degree, number>::SizeType
+VariableContainer<dim, degree, number>::get_jxw() const
+{
+  // For dim = 1, the scalar and vector FEEvaluation objects are degenerate.
+  if constexpr (dim == 1)
+    {
+      auto iterator = std::ranges::find_if(feeval_vector,
+                                           [](const auto &ptr)
+                                           {
+                                             return ptr != nullptr;
+                                           });
+      Assert(iterator != feeval_vector.end(),
+             dealii::ExcMessage("All FEEvaluation objects were nullptr."));
+      return (*iterator)->JxW(q_point);
+    }
+  else
+    {
+      // Create a filtered view that ignores nullptrs
+      auto filtered_view = feeval_vector | std::views::filter(
+                                             [](const auto &v)
+                                             {
+                                               return !std::visit(
+                                                 [](const auto &ptr)
+                                                 {
+                                                   return ptr == nullptr;
+                                                 },
+                                                 v);
+                                             });
+      // Grab the first iterator and return the JxW value
+      auto iterator = filtered_view.begin();
+      Assert(iterator != filtered_view.end(),
+             dealii::ExcMessage("All FEEvaluation variants were nullptr."));
+      return std::visit(
+        [this](const auto &ptr)
+        {
+          return ptr->JxW(q_point);
+        },
+        *iterator);
+    }
+}
+
 template <unsigned int dim, unsigned int degree, typename number>
 void
 VariableContainer<dim, degree, number>::reinit_and_eval(
@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <prismspf/solvers/anderson_acceleration.h>
+
+#include <prismspf/config.h>
+
+#include <cmath>
+#include <vector>
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+template <typename number>
+AndersonAcceleration<number>::AndersonAcceleration(unsigned int _depth, number _mixing)
+  : depth(_depth)
+  , mixing(_mixing)
+{
+  Assert(mixing > 0.0 && mixing <= 1.0,
+         dealii::ExcMessage("The mixing parameter must be in (0, 1]"));
+}
+
+template <typename number>
+void
+AndersonAcceleration<number>::clear()
+{
+  residual_norm = 0.0;
+  delta_residual.clear();
+  delta_iterate.clear();
+  previous_residual.clear();
+  previous_iterate.clear();
+}
+
+template <typename number>
+number
+AndersonAcceleration<number>::stacked_dot(const std::vector<VectorType> &vector_1,
+                                          const std::vector<VectorType> &vector_2)
+{
+  Assert(vector_1.size() == vector_2.size(),
+         dealii::ExcDimensionMismatch(vector_1.size(), vector_2.size()));
+
+  number value = 0.0;
+  for (unsigned int block = 0; block < vector_1.size(); block++)
+    {
+      value += vector_1[block] * vector_2[block];
+    }
+  return value;
+}
+
+template <typename number>
+void
+AndersonAcceleration<number>::apply(const std::vector<VectorType>   &old_iterate,
+                                    const std::vector<VectorType *> &iterate)
+{
+  Assert(old_iterate.size() == iterate.size(),
+         dealii::ExcDimensionMismatch(old_iterate.size(), iterate.size()));
+
+  const unsigned int n_blocks = iterate.size();
+
+  // Compute the fixed-point residual f_k = g_k - x_k
+  std::vector<VectorType> residual(n_blocks);
+  for (unsigned int block = 0; block < n_blocks; block++)
+    {
+      residual[block] = *iterate[block];
+      residual[block] -= old_iterate[block];
+    }
+  const number new_residual_norm = std::sqrt(stacked_dot(residual, residual));
+
+  // Update the history. If the fixed-point residual grows we restart the acceleration.
+  if (!previous_residual.empty())
+    {
+      if (new_residual_norm > residual_norm)
+        {
+          delta_residual.clear();
+          delta_iterate.clear();
+        }
+      else
+        {
+          for (unsigned int block = 0; block < n_blocks; block++)
+            {
+              previous_residual[block].sadd(-1.0, 1.0, residual[block]);
+              previous_iterate[block].sadd(-1.0, 1.0, *iterate[block]);
+            }
+          delta_residual.push_back(std::move(previous_residual));
+          delta_iterate.push_back(std::move(previous_iterate));
+
+          if (delta_residual.size() > depth)
+            {
+              delta_residual.pop_front();
+              delta_iterate.pop_front();
+            }
+        }
+    }
+  residual_norm = new_residual_norm;
+
+  previous_residual = residual;
+  previous_iterate.resize(n_blocks);
+  for (unsigned int block = 0; block < n_blocks; block++)
+    {
+      previous_iterate[block] = *iterate[block];
+    }
+
+  // Solve the least-squares problem min ‖f_k - ΔF γ‖ through the normal equations. A
+  // small Tikhonov term keeps nearly linearly dependent histories from blowing up.
+  const unsigned int history_size = delta_residual.size();
+  if (history_size > 0)
+    {
+      dealii::FullMatrix<number> gram(history_size, history_size);
+      dealii::Vector<number>     rhs(history_size);
+      dealii::Vector<number>     gamma(history_size);
+      number                     trace = 0.0;
+      for (unsigned int i = 0; i < history_size; i++)
+        {
+          for (unsigned int j = 0; j <= i; j++)
+            {
+              gram(i, j) = stacked_dot(delta_residual[i], delta_residual[j]);
+              gram(j, i) = gram(i, j);
+            }
+          rhs(i) = stacked_dot(delta_residual[i], residual);
+          trace += gram(i, i);
+        }
+      gram.diagadd(1.0e-10 * trace / history_size);
+      gram.gauss_jordan();
+      gram.vmult(gamma, rhs);
+
+      for (unsigned int i = 0; i < history_size; i++)
+        {
+          for (unsigned int block = 0; block < n_blocks; block++)
+            {
+              iterate[block]->add(-gamma(i), delta_iterate[i][block]);
+              residual[block].add(-gamma(i), delta_residual[i][block]);
+            }
+        }
+    }
+
+  // Apply the mixing parameter
+  if (mixing < 1.0)
+    {
+      for (unsigned int block = 0; block < n_blocks; block++)
+        {
+          iterate[block]->add(mixing - 1.0, residual[block]);
+        }
+    }
+}
+
+#include "solvers/anderson_acceleration.inst"
+
+PRISMS_PF_END_NAMESPACE
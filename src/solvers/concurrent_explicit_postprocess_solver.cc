@@ -12,6 +12,8 @@
 
 #include <prismspf/config.h>
 
+#include <map>
+#include <string>
 #include <vector>
 
 PRISMS_PF_BEGIN_NAMESPACE
@@ -76,6 +78,19 @@ ConcurrentExplicitPostprocessSolver<dim, degree, number>::print()
   this->ConcurrentSolver<dim, degree, number>::print();
 }
 
+template <unsigned int dim, unsigned int degree, typename number>
+std::map<std::string, double>
+ConcurrentExplicitPostprocessSolver<dim, degree, number>::get_reductions()
+{
+  // The system matrix is only created if there are fields to solve
+  if (this->solver_is_empty())
+    {
+      return {};
+    }
+
+  return this->get_system_matrix()->get_reductions();
+}
+
 #include "solvers/concurrent_explicit_postprocess_solver.inst"
 
 PRISMS_PF_END_NAMESPACE
\ No newline at end of file
@@ -202,13 +202,16 @@ ConcurrentSolver<dim, degree, number>::solve_explicit_equations(
   function(new_solution_subset, solution_subset);
 
   // Scale the update by the respective (Scalar/Vector) invm. Note that we do this with
-  // the original solution set to avoid some messy mapping.
-  for (auto [index, vector] : this->get_solution_handler().get_new_solution_vector())
+  // the original solution set to avoid some messy mapping. This also checks that the
+  // update is finite.
+  auto &solution_handler = this->get_solution_handler();
+  for (const auto &[index, vector] : solution_handler.get_new_solution_vector())
     {
       if (this->get_subset_attributes().find(index) !=
           this->get_subset_attributes().end())
         {
-          vector->scale(this->get_invm_handler().get_invm(index));
+          solution_handler.scale_new_solution(index,
+                                              this->get_invm_handler().get_invm(index));
         }
     }
 
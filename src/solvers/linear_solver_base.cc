@@ -3,6 +3,7 @@
 
 #include <deal.II/base/exceptions.h>
 
+#include <prismspf/core/conditional_ostreams.h>
 #include <prismspf/core/constraint_handler.h>
 #include <prismspf/core/matrix_free_handler.h>
 #include <prismspf/core/matrix_free_operator.h>
@@ -38,6 +39,19 @@ LinearSolverBase<dim, degree, number>::LinearSolverBase(
 {
   // Creating map to match types
   subset_attributes.emplace(field_index, *variable_attributes);
+
+  // Check whether the linear solver tolerance should be set by the nonlinear solver
+  if (variable_attributes->get_field_solve_type() ==
+        FieldSolveType::NonexplicitSelfnonlinear ||
+      variable_attributes->get_field_solve_type() ==
+        FieldSolveType::NonexplicitCononlinear)
+    {
+      is_nonlinear     = true;
+      use_forcing_term = _solver_context.get_user_inputs()
+                           .get_nonlinear_solve_parameters()
+                           .get_nonlinear_solve_parameters(field_index)
+                           .use_eisenstat_walker;
+    }
 }
 
 template <unsigned int dim, unsigned int degree, typename number>
@@ -277,6 +291,36 @@ template <unsigned int dim, unsigned int degree, typename number>
 void
 LinearSolverBase<dim, degree, number>::compute_solver_tolerance()
 {
+  residual_norm = residual->l2_norm();
+
+  if (is_nonlinear && first_newton_iteration)
+    {
+      initial_residual_norm = residual_norm;
+    }
+
+  // For inexact Newton solves the tolerance is relative to the current nonlinear residual
+  // and loosens or tightens with the convergence of the nonlinear solve.
+  if (use_forcing_term)
+    {
+      forcing_term = first_newton_iteration
+                       ? solver_context->get_user_inputs()
+                           .get_nonlinear_solve_parameters()
+                           .get_nonlinear_solve_parameters(field_index)
+                           .initial_forcing_term
+                       : solver_context->get_user_inputs()
+                           .get_nonlinear_solve_parameters()
+                           .get_nonlinear_solve_parameters(field_index)
+                           .compute_forcing_term(residual_norm,
+                                                 old_residual_norm,
+                                                 forcing_term);
+      old_residual_norm      = residual_norm;
+      first_newton_iteration = false;
+      tolerance              = forcing_term * residual_norm;
+
+      return;
+    }
+  first_newton_iteration = false;
+
   tolerance = solver_context->get_user_inputs()
                     .get_linear_solve_parameters()
                     .get_linear_solve_parameters(field_index)
@@ -285,13 +329,105 @@ LinearSolverBase<dim, degree, number>::compute_solver_tolerance()
                       .get_linear_solve_parameters()
                       .get_linear_solve_parameters(field_index)
                       .tolerance *
-                    residual->l2_norm()
+                    residual_norm
                 : solver_context->get_user_inputs()
                     .get_linear_solve_parameters()
                     .get_linear_solve_parameters(field_index)
                     .tolerance;
 }
 
+template <unsigned int dim, unsigned int degree, typename number>
+void
+LinearSolverBase<dim, degree, number>::compute_residual(VectorType &dst) const
+{
+  system_matrix->compute_residual(
+    dst,
+    *solver_context->get_solution_handler().get_solution_vector(field_index,
+                                                                DependencyType::Normal));
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+LinearSolverBase<dim, degree, number>::update_solution(const number &step_length)
+{
+  auto *solution =
+    solver_context->get_solution_handler().get_solution_vector(field_index,
+                                                               DependencyType::Normal);
+
+  // Update the solutions, checking that they stay finite
+  solver_context->get_solution_handler().add_to_solution(field_index,
+                                                         step_length,
+                                                         *newton_update);
+
+  // Apply constraints
+  // This may be redundant with the constraints on the update step.
+  apply_constraints();
+
+  if (!is_nonlinear)
+    {
+      return;
+    }
+
+  const auto &nonlinear_parameters = solver_context->get_user_inputs()
+                                       .get_nonlinear_solve_parameters()
+                                       .get_nonlinear_solve_parameters(field_index);
+  if (!nonlinear_parameters.requires_updated_residual())
+    {
+      return;
+    }
+
+  // Evaluate the residual at the updated solution
+  solution->update_ghost_values();
+  system_matrix->compute_residual(*residual, *solution);
+  updated_residual_norm = residual->l2_norm();
+
+  if (!nonlinear_parameters.use_backtracking_line_search)
+    {
+      return;
+    }
+
+  // Backtrack from x + λ δx to x + τ λ δx until the residual decreases sufficiently
+  number       current_step_length = step_length;
+  unsigned int backtrack           = 0;
+  while (!nonlinear_parameters.is_sufficient_decrease(current_step_length,
+                                                      updated_residual_norm,
+                                                      residual_norm))
+    {
+      if (backtrack >= nonlinear_parameters.max_backtracks)
+        {
+          ConditionalOStreams::pout_base()
+            << "Warning: backtracking line search did not find a sufficient decrease in "
+               "the residual for field "
+            << field_index << ".\n";
+          break;
+        }
+
+      const number new_step_length =
+        current_step_length * nonlinear_parameters.step_size_modifier;
+      solver_context->get_solution_handler().add_to_solution(field_index,
+                                                             new_step_length -
+                                                               current_step_length,
+                                                             *newton_update);
+      apply_constraints();
+      current_step_length = new_step_length;
+
+      solution->update_ghost_values();
+      system_matrix->compute_residual(*residual, *solution);
+      updated_residual_norm = residual->l2_norm();
+
+      backtrack++;
+    }
+
+  if (get_user_inputs().get_output_parameters().should_output(
+        get_user_inputs().get_temporal_discretization().get_increment()))
+    {
+      ConditionalOStreams::pout_summary()
+        << "  field: " << field_index << " Step length: " << current_step_length
+        << " Backtracks: " << backtrack << "\n"
+        << std::flush;
+    }
+}
+
 #include "solvers/linear_solver_base.inst"
 
 PRISMS_PF_END_NAMESPACE
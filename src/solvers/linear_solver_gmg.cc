@@ -195,6 +195,12 @@ GMGSolver<dim, degree, number>::reinit()
   // Call the base class reinit
   this->LinearSolverBase<dim, degree, number>::reinit();
 
+  // Release the multigrid objects that depend on the old mesh
+  preconditioner.reset();
+  multigrid.reset();
+  mg_coarse.reset();
+  mg_smoother.reset();
+
   // Basic intialization that is the same as the identity solve.
   this->clear_system_matrices();
   this->initialize_system_matrices();
@@ -289,8 +295,6 @@ template <unsigned int dim, unsigned int degree, typename number>
 void
 GMGSolver<dim, degree, number>::solve(const number &step_length)
 {
-  const auto *current_dof_handler =
-    this->get_dof_handler().get_dof_handlers().at(this->get_field_index());
   auto *solution =
     this->get_solution_handler().get_solution_vector(this->get_field_index(),
                                                      DependencyType::Normal);
@@ -312,6 +316,43 @@ GMGSolver<dim, degree, number>::solve(const number &step_length)
   this->get_solver_control().set_tolerance(this->get_tolerance());
   dealii::SolverCG<VectorType> cg_solver(this->get_solver_control());
 
+  // Update the multigrid preconditioner
+  update_preconditioner();
+
+  try
+    {
+      *this->get_newton_update() = 0.0;
+      cg_solver.solve(*(this->get_update_system_matrix()),
+                      *(this->get_newton_update()),
+                      *(this->get_residual()),
+                      *preconditioner);
+    }
+  catch (...)
+    {
+      ConditionalOStreams::pout_base()
+        << "Warning: linear solver did not converge as per set tolerances.\n";
+    }
+  this->get_constraint_handler()
+    .get_constraint(this->get_field_index())
+    .set_zero(*this->get_newton_update());
+
+  if (this->get_user_inputs().get_output_parameters().should_output(
+        this->get_user_inputs().get_temporal_discretization().get_increment()))
+    {
+      ConditionalOStreams::pout_summary()
+        << " Final residual: " << this->get_solver_control().last_value()
+        << " Steps: " << this->get_solver_control().last_step() << "\n"
+        << std::flush;
+    }
+
+  // Update the solutions
+  this->update_solution(step_length);
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+GMGSolver<dim, degree, number>::update_preconditioner()
+{
   // Grab some data from the VariableAttributes
   const Types::Index max_fields = this->get_variable_attributes().get_max_fields();
   const Types::Index max_dependency_types =
@@ -363,9 +404,15 @@ GMGSolver<dim, degree, number>::solve(const number &step_length)
         }
     }
 
+  // Release the previous multigrid objects in reverse order of their creation since they
+  // hold references to each other
+  preconditioner.reset();
+  multigrid.reset();
+  mg_coarse.reset();
+  mg_smoother.reset();
+
   // Create smoother for each level
-  using SmootherType = dealii::PreconditionChebyshev<LevelMatrixType, MGVectorType>;
-  dealii::MGSmootherPrecondition<LevelMatrixType, SmootherType, MGVectorType> mg_smoother;
+  mg_smoother = std::make_unique<MGSmootherType>();
   dealii::MGLevelObject<typename SmootherType::AdditionalData> smoother_data(min_level,
                                                                              max_level);
   for (unsigned int level = min_level; level <= max_level; ++level)
@@ -391,62 +438,36 @@ GMGSolver<dim, degree, number>::solve(const number &step_length)
       smoother_data[level].constraints.copy_from(
         this->get_constraint_handler().get_mg_constraint(level, change_local_index));
     }
-  mg_smoother.initialize(*mg_operators, smoother_data);
+  mg_smoother->initialize(*mg_operators, smoother_data);
 
-  dealii::MGCoarseGridApplySmoother<MGVectorType> mg_coarse;
-  mg_coarse.initialize(mg_smoother);
+  mg_coarse = std::make_unique<dealii::MGCoarseGridApplySmoother<MGVectorType>>();
+  mg_coarse->initialize(*mg_smoother);
 
   // Create multigrid object
-  dealii::Multigrid<MGVectorType> multigrid(
+  multigrid = std::make_unique<dealii::Multigrid<MGVectorType>>(
     *mg_matrix,
-    mg_coarse,
+    *mg_coarse,
     *mg_transfer[change_local_index],
-    mg_smoother,
-    mg_smoother,
+    *mg_smoother,
+    *mg_smoother,
     min_level,
     max_level,
     dealii::Multigrid<MGVectorType>::Cycle::v_cycle);
 
   // Create the preconditioner
-  const dealii::PreconditionMG<dim,
-                               MGVectorType,
-                               dealii::MGTransferGlobalCoarsening<dim, MGVectorType>>
-    preconditioner(*current_dof_handler, multigrid, *mg_transfer[change_local_index]);
-
-  try
-    {
-      *this->get_newton_update() = 0.0;
-      cg_solver.solve(*(this->get_update_system_matrix()),
-                      *(this->get_newton_update()),
-                      *(this->get_residual()),
-                      preconditioner);
-    }
-  catch (...)
-    {
-      ConditionalOStreams::pout_base()
-        << "Warning: linear solver did not converge as per set tolerances.\n";
-    }
-  this->get_constraint_handler()
-    .get_constraint(this->get_field_index())
-    .set_zero(*this->get_newton_update());
-
-  if (this->get_user_inputs().get_output_parameters().should_output(
-        this->get_user_inputs().get_temporal_discretization().get_increment()))
-    {
-      ConditionalOStreams::pout_summary()
-        << " Final residual: " << this->get_solver_control().last_value()
-        << " Steps: " << this->get_solver_control().last_step() << "\n"
-        << std::flush;
-    }
-
-  // Update the solutions
-  (*solution).add(step_length, *this->get_newton_update());
+  preconditioner = std::make_unique<PreconditionerType>(
+    *(this->get_dof_handler().get_dof_handlers().at(this->get_field_index())),
+    *multigrid,
+    *mg_transfer[change_local_index]);
+}
 
-  // Apply constraints
-  // This may be redundant with the constraints on the update step.
-  this->get_constraint_handler()
-    .get_constraint(this->get_field_index())
-    .distribute(*solution);
+template <unsigned int dim, unsigned int degree, typename number>
+void
+GMGSolver<dim, degree, number>::apply_preconditioner(VectorType       &dst,
+                                                     const VectorType &src) const
+{
+  Assert(preconditioner != nullptr, dealii::ExcNotInitialized());
+  preconditioner->vmult(dst, src);
 }
 
 #include "solvers/linear_solver_gmg.inst"
@@ -116,13 +116,7 @@ IdentitySolver<dim, degree, number>::solve(const number &step_length)
     }
 
   // Update the solutions
-  (*solution).add(step_length, *this->get_newton_update());
-
-  // Apply constraints
-  // This may be redundant with the constraints on the update step.
-  this->get_constraint_handler()
-    .get_constraint(this->get_field_index())
-    .distribute(*solution);
+  this->update_solution(step_length);
 }
 
 #include "solvers/linear_solver_identity.inst"
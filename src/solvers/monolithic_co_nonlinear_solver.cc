@@ -0,0 +1,499 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/lac/linear_operator.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+
+#include <prismspf/core/conditional_ostreams.h>
+#include <prismspf/core/constraint_handler.h>
+#include <prismspf/core/matrix_free_operator.h>
+#include <prismspf/core/timer.h>
+#include <prismspf/core/type_enums.h>
+#include <prismspf/core/types.h>
+
+#include <prismspf/user_inputs/nonlinear_solve_parameters.h>
+
+#include <prismspf/solvers/linear_solver_base.h>
+#include <prismspf/solvers/linear_solver_gmg.h>
+#include <prismspf/solvers/linear_solver_identity.h>
+#include <prismspf/solvers/monolithic_co_nonlinear_solver.h>
+#include <prismspf/solvers/sequential_solver.h>
+#include <prismspf/solvers/solver_context.h>
+
+#include <prismspf/config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <vector>
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+template <unsigned int dim, unsigned int degree, typename number>
+MonolithicCoNonlinearSolver<dim, degree, number>::MonolithicCoNonlinearSolver(
+  const SolverContext<dim, degree, number> &_solver_context,
+  Types::Index                              _solve_priority)
+  : SequentialSolver<dim, degree, number>(_solver_context,
+                                          FieldSolveType::NonexplicitCononlinear,
+                                          _solve_priority)
+{}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+MonolithicCoNonlinearSolver<dim, degree, number>::init()
+{
+  // Call the base class init
+  this->SequentialSolver<dim, degree, number>::init();
+
+  // If the solver is empty we can just return early.
+  if (this->solver_is_empty())
+    {
+      return;
+    }
+
+  // Init the linear and auxiliary solvers. The linear solvers provide the residual and
+  // the preconditioner of each diagonal block.
+  const auto &nonlinear_solve_parameters =
+    this->get_user_inputs().get_nonlinear_solve_parameters();
+  const NonlinearSolverParameters *line_search_parameters = nullptr;
+  for (const auto &[index, variable] : this->get_subset_attributes())
+    {
+      if (variable.get_pde_type() == PDEType::Auxiliary)
+        {
+          this->init_explicit_solver(variable);
+        }
+      else if (variable.get_pde_type() == PDEType::ImplicitTimeDependent ||
+               variable.get_pde_type() == PDEType::TimeIndependent)
+        {
+          this->init_linear_solver(variable);
+
+          // The block system takes one step for all of its fields, so they must share the
+          // step length and line search
+          const auto &field_parameters =
+            nonlinear_solve_parameters.get_nonlinear_solve_parameters(index);
+          if (line_search_parameters == nullptr)
+            {
+              line_search_parameters = &field_parameters;
+            }
+          AssertThrow(field_parameters.has_same_line_search(*line_search_parameters),
+                      dealii::ExcMessage(
+                        "The fields of the monolithic co-nonlinear solve must have the "
+                        "same step length and backtracking line search parameters."));
+        }
+      else
+        {
+          AssertThrow(false, UnreachableCode());
+        }
+    }
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+MonolithicCoNonlinearSolver<dim, degree, number>::reinit()
+{
+  // Call the base class reinit
+  this->SequentialSolver<dim, degree, number>::reinit();
+
+  // If the solver is empty we can just return early.
+  if (this->solver_is_empty())
+    {
+      return;
+    }
+
+  // Reinit the linear and auxiliary solvers
+  for (const auto &[index, variable] : this->get_subset_attributes())
+    {
+      if (variable.get_pde_type() == PDEType::Auxiliary)
+        {
+          this->reinit_explicit_solver(variable);
+        }
+      else if (variable.get_pde_type() == PDEType::ImplicitTimeDependent ||
+               variable.get_pde_type() == PDEType::TimeIndependent)
+        {
+          this->reinit_linear_solver(variable);
+        }
+      else
+        {
+          AssertThrow(false, UnreachableCode());
+        }
+    }
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+MonolithicCoNonlinearSolver<dim, degree, number>::solve()
+{
+  // Call the base class solve
+  this->SequentialSolver<dim, degree, number>::solve();
+
+  // If the solver is empty we can just return early.
+  if (this->solver_is_empty())
+    {
+      return;
+    }
+
+  const bool should_output =
+    this->get_user_inputs().get_output_parameters().should_output(
+      this->get_user_inputs().get_temporal_discretization().get_increment());
+  const auto &nonlinear_solve_parameters =
+    this->get_user_inputs().get_nonlinear_solve_parameters();
+
+  // Store the current solutions so they can become the OldOne solutions once the solve
+  // has updated them in place and determine which fields are in the block system. Like
+  // the sequential solver, ImplicitTimeDependent fields are skipped at the 0th
+  // increment.
+  block_fields.clear();
+  unsigned int max_iterations = 0;
+  for (const auto &[index, variable] : this->get_subset_attributes())
+    {
+      this->get_solution_handler().prepare_history(index);
+
+      if (variable.get_pde_type() == PDEType::Auxiliary ||
+          (variable.get_pde_type() == PDEType::ImplicitTimeDependent &&
+           this->get_user_inputs().get_temporal_discretization().get_increment() == 0))
+        {
+          continue;
+        }
+
+      block_fields.push_back(index);
+      max_iterations =
+        std::max(max_iterations,
+                 nonlinear_solve_parameters.get_nonlinear_solve_parameters(index)
+                   .max_iterations);
+    }
+
+  if (!block_fields.empty())
+    {
+      // Init the block vectors
+      reinit_block_vector(residual);
+      reinit_block_vector(perturbed_residual);
+      reinit_block_vector(newton_update);
+      linearization_point.resize(block_fields.size());
+      perturbed_solution.resize(block_fields.size());
+      for (unsigned int block = 0; block < block_fields.size(); block++)
+        {
+          const auto *solution = this->get_solution_handler().get_solution_vector(
+            block_fields[block],
+            DependencyType::Normal);
+          linearization_point[block].reinit(*solution);
+          perturbed_solution[block].reinit(*solution);
+        }
+
+      // Compute the initial residual
+      compute_residual(residual);
+      std::vector<number> initial_residual_norm(block_fields.size());
+      for (unsigned int block = 0; block < block_fields.size(); block++)
+        {
+          initial_residual_norm[block] = residual.block(block).l2_norm();
+        }
+
+      // Create the block Jacobian and the block-diagonal preconditioner
+      dealii::LinearOperator<BlockVectorType, BlockVectorType> jacobian;
+      jacobian.vmult = [this](BlockVectorType &dst, const BlockVectorType &src)
+      {
+        apply_jacobian(dst, src);
+      };
+      jacobian.reinit_range_vector = [this](BlockVectorType &vector, bool omit_zeroing)
+      {
+        vector.reinit(residual, omit_zeroing);
+      };
+      jacobian.reinit_domain_vector = jacobian.reinit_range_vector;
+
+      dealii::LinearOperator<BlockVectorType, BlockVectorType> preconditioner;
+      preconditioner.vmult = [this](BlockVectorType &dst, const BlockVectorType &src)
+      {
+        apply_preconditioner(dst, src);
+      };
+      preconditioner.reinit_range_vector  = jacobian.reinit_range_vector;
+      preconditioner.reinit_domain_vector = jacobian.reinit_range_vector;
+
+      // The fields of the block system share the line search parameters, which is
+      // checked on init
+      const auto &line_search_parameters =
+        nonlinear_solve_parameters.get_nonlinear_solve_parameters(block_fields.front());
+
+      bool         unconverged = true;
+      unsigned int iteration   = 0;
+      while (unconverged)
+        {
+          if (should_output)
+            {
+              ConditionalOStreams::pout_summary()
+                << "Nonlinear solver step: " << iteration << "\n";
+            }
+
+          // Store the linearization point and update the preconditioners
+          double linearization_point_norm_sqr = 0.0;
+          for (unsigned int block = 0; block < block_fields.size(); block++)
+            {
+              linearization_point[block].copy_locally_owned_data_from(
+                *(this->get_solution_handler().get_solution_vector(
+                  block_fields[block],
+                  DependencyType::Normal)));
+              linearization_point_norm_sqr += linearization_point[block].norm_sqr();
+              this->get_linear_solver(block_fields[block]).update_preconditioner();
+            }
+          linearization_point_norm = std::sqrt(linearization_point_norm_sqr);
+
+          // Solve the block system
+          const number residual_norm = residual.l2_norm();
+          dealii::SolverControl solver_control(
+            nonlinear_solve_parameters.get_monolithic_linear_iterations(),
+            nonlinear_solve_parameters.get_monolithic_linear_tolerance() *
+              residual_norm);
+          dealii::SolverGMRES<BlockVectorType> gmres_solver(
+            solver_control,
+            typename dealii::SolverGMRES<BlockVectorType>::AdditionalData(
+              nonlinear_solve_parameters.get_monolithic_linear_restart(),
+              true));
+          try
+            {
+              newton_update = 0.0;
+              gmres_solver.solve(jacobian, newton_update, residual, preconditioner);
+            }
+          catch (...)
+            {
+              ConditionalOStreams::pout_base()
+                << "Warning: linear solver did not converge as per set tolerances.\n";
+            }
+          for (unsigned int block = 0; block < block_fields.size(); block++)
+            {
+              this->get_constraint_handler()
+                .get_constraint(block_fields[block])
+                .set_zero(newton_update.block(block));
+            }
+
+          if (should_output)
+            {
+              ConditionalOStreams::pout_summary()
+                << "  Initial residual: " << residual_norm
+                << " Final residual: " << solver_control.last_value()
+                << " Steps: " << solver_control.last_step() << "\n"
+                << std::flush;
+            }
+
+          // Update the solutions, backtracking on the residual norm of the block system if
+          // requested
+          number       step_length = line_search_parameters.step_length;
+          unsigned int backtrack   = 0;
+          while (true)
+            {
+              for (unsigned int block = 0; block < block_fields.size(); block++)
+                {
+                  auto *solution = this->get_solution_handler().get_solution_vector(
+                    block_fields[block],
+                    DependencyType::Normal);
+                  solution->copy_locally_owned_data_from(linearization_point[block]);
+                  this->get_solution_handler().add_to_solution(
+                    block_fields[block],
+                    step_length,
+                    newton_update.block(block));
+                  this->get_constraint_handler()
+                    .get_constraint(block_fields[block])
+                    .distribute(*solution);
+                }
+              update_block_ghosts();
+
+              compute_residual(residual);
+
+              if (!line_search_parameters.use_backtracking_line_search ||
+                  line_search_parameters.is_sufficient_decrease(step_length,
+                                                                residual.l2_norm(),
+                                                                residual_norm))
+                {
+                  break;
+                }
+              if (backtrack >= line_search_parameters.max_backtracks)
+                {
+                  ConditionalOStreams::pout_base()
+                    << "Warning: backtracking line search did not find a sufficient "
+                       "decrease in the residual of the block system.\n";
+                  break;
+                }
+              step_length *= line_search_parameters.step_size_modifier;
+              backtrack++;
+            }
+
+          // Check the convergence of each field
+          unconverged = false;
+          for (unsigned int block = 0; block < block_fields.size(); block++)
+            {
+              const number newton_update_norm = newton_update.block(block).l2_norm();
+              const number field_residual_norm = residual.block(block).l2_norm();
+
+              if (should_output)
+                {
+                  ConditionalOStreams::pout_summary()
+                    << "  field: " << block_fields[block]
+                    << " Newton update norm: " << newton_update_norm
+                    << " Residual norm: " << field_residual_norm << "\n"
+                    << std::flush;
+                }
+
+              if (!nonlinear_solve_parameters
+                     .get_nonlinear_solve_parameters(block_fields[block])
+                     .is_converged(newton_update_norm,
+                                   field_residual_norm,
+                                   initial_residual_norm[block]))
+                {
+                  unconverged = true;
+                }
+            }
+
+          // Update the iteration counter
+          iteration++;
+
+          // Check if the maximum number of iterations has been reached
+          if (unconverged && iteration >= max_iterations)
+            {
+              unconverged = false;
+              ConditionalOStreams::pout_base() << "Warning: nonlinear solver did not "
+                                                  "converge as per set tolerances.\n\n"
+                                               << std::flush;
+            }
+        }
+    }
+
+  // Update the solutions
+  for (const auto &[index, variable] : this->get_subset_attributes())
+    {
+      // The solve has overwritten the solution vectors in place, so we only have to
+      // rotate the old solutions.
+      this->get_solution_handler().rotate_history(index);
+    }
+
+  // Update the ghosts
+  Timer::start_section("Update ghosts");
+  this->get_solution_handler().update_ghosts();
+  Timer::end_section("Update ghosts");
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+MonolithicCoNonlinearSolver<dim, degree, number>::print()
+{
+  // Print the base class information
+  this->SequentialSolver<dim, degree, number>::print();
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+MonolithicCoNonlinearSolver<dim, degree, number>::reinit_block_vector(
+  BlockVectorType &vector) const
+{
+  vector.reinit(block_fields.size());
+  for (unsigned int block = 0; block < block_fields.size(); block++)
+    {
+      vector.block(block).reinit(
+        *(this->get_solution_handler().get_solution_vector(block_fields[block],
+                                                           DependencyType::Normal)));
+    }
+  vector.collect_sizes();
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+MonolithicCoNonlinearSolver<dim, degree, number>::compute_residual(BlockVectorType &dst)
+{
+  // Reevaluate the auxiliary fields at the current solution
+  for (const auto &[index, variable] : this->get_subset_attributes())
+    {
+      if (variable.get_pde_type() == PDEType::Auxiliary)
+        {
+          this->evaluate_explicit_solver(variable);
+        }
+    }
+
+  for (unsigned int block = 0; block < block_fields.size(); block++)
+    {
+      this->get_linear_solver(block_fields[block]).compute_residual(dst.block(block));
+    }
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+MonolithicCoNonlinearSolver<dim, degree, number>::update_block_ghosts() const
+{
+  Timer::start_section("Update ghosts");
+  for (const auto &index : block_fields)
+    {
+      this->get_solution_handler().update_ghosts(index);
+    }
+  Timer::end_section("Update ghosts");
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+MonolithicCoNonlinearSolver<dim, degree, number>::apply_jacobian(
+  BlockVectorType       &dst,
+  const BlockVectorType &src)
+{
+  const double src_norm = src.l2_norm();
+  if (src_norm == 0.0)
+    {
+      dst = 0.0;
+      return;
+    }
+
+  // Choose the differencing step relative to the size of the linearization point. The
+  // step is computed in double so it doesn't lose precision for float vectors.
+  const double epsilon = std::sqrt(std::numeric_limits<number>::epsilon()) *
+                         (1.0 + linearization_point_norm) / src_norm;
+
+  // Swap the perturbed solutions in. The linearization point is then swapped back with
+  // its ghost values, so only the perturbed solutions have to be communicated.
+  for (unsigned int block = 0; block < block_fields.size(); block++)
+    {
+      perturbed_solution[block].copy_locally_owned_data_from(linearization_point[block]);
+      perturbed_solution[block].add(static_cast<number>(epsilon), src.block(block));
+      Timer::start_section("Update ghosts");
+      perturbed_solution[block].update_ghost_values();
+      Timer::end_section("Update ghosts");
+      this->get_solution_handler()
+        .get_solution_vector(block_fields[block], DependencyType::Normal)
+        ->swap(perturbed_solution[block]);
+    }
+
+  compute_residual(perturbed_residual);
+
+  for (unsigned int block = 0; block < block_fields.size(); block++)
+    {
+      this->get_solution_handler()
+        .get_solution_vector(block_fields[block], DependencyType::Normal)
+        ->swap(perturbed_solution[block]);
+    }
+
+  // The LHS is the negative derivative of the residual
+  dst.equ(static_cast<number>(1.0 / epsilon), residual);
+  dst.add(static_cast<number>(-1.0 / epsilon), perturbed_residual);
+  for (unsigned int block = 0; block < block_fields.size(); block++)
+    {
+      this->get_constraint_handler()
+        .get_constraint(block_fields[block])
+        .set_zero(dst.block(block));
+    }
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+MonolithicCoNonlinearSolver<dim, degree, number>::apply_preconditioner(
+  BlockVectorType       &dst,
+  const BlockVectorType &src)
+{
+  for (unsigned int block = 0; block < block_fields.size(); block++)
+    {
+      this->get_linear_solver(block_fields[block])
+        .apply_preconditioner(dst.block(block), src.block(block));
+      this->get_constraint_handler()
+        .get_constraint(block_fields[block])
+        .set_zero(dst.block(block));
+    }
+}
+
+#include "solvers/monolithic_co_nonlinear_solver.inst"
+
+PRISMS_PF_END_NAMESPACE
@@ -4,11 +4,13 @@
 #include <deal.II/base/exceptions.h>
 
 #include <prismspf/core/conditional_ostreams.h>
+#include <prismspf/core/constraint_handler.h>
 #include <prismspf/core/matrix_free_operator.h>
 #include <prismspf/core/timer.h>
 #include <prismspf/core/type_enums.h>
 #include <prismspf/core/types.h>
 
+#include <prismspf/solvers/anderson_acceleration.h>
 #include <prismspf/solvers/linear_solver_gmg.h>
 #include <prismspf/solvers/linear_solver_identity.h>
 #include <prismspf/solvers/sequential_co_nonlinear_solver.h>
@@ -17,7 +19,9 @@
 
 #include <prismspf/config.h>
 
+#include <memory>
 #include <ostream>
+#include <vector>
 
 PRISMS_PF_BEGIN_NAMESPACE
 
@@ -60,6 +64,16 @@ SequentialCoNonlinearSolver<dim, degree, number>::init()
           AssertThrow(false, UnreachableCode());
         }
     }
+
+  // Init the Anderson acceleration
+  const auto &nonlinear_solve_parameters =
+    this->get_user_inputs().get_nonlinear_solve_parameters();
+  if (nonlinear_solve_parameters.get_anderson_depth() > 0)
+    {
+      anderson_acceleration = std::make_unique<AndersonAcceleration<number>>(
+        nonlinear_solve_parameters.get_anderson_depth(),
+        nonlinear_solve_parameters.get_anderson_mixing());
+    }
 }
 
 template <unsigned int dim, unsigned int degree, typename number>
@@ -107,18 +121,41 @@ SequentialCoNonlinearSolver<dim, degree, number>::solve()
       return;
     }
 
-  // Grab the old solution fields in temporary variables
-  std::map<Types::Index, typename SolutionHandler<dim, number>::VectorType> old_solutions;
+  // Store the current solutions so they can become the OldOne solutions once the solve
+  // has updated them in place
   for (const auto &[index, variable] : this->get_subset_attributes())
     {
       if (variable.get_pde_type() != PDEType::Auxiliary)
         {
-          old_solutions[index] =
-            *(this->get_solution_handler().get_solution_vector(index,
-                                                               DependencyType::Normal));
+          this->get_solution_handler().prepare_history(index);
+
+          // Reset the forcing terms and residual history for this nonlinear solve
+          this->get_linear_solver(index).reset_nonlinear_history();
         }
     }
 
+  // Grab the iterate of the block iteration for Anderson acceleration. This is the set of
+  // nonauxiliary solution vectors.
+  using VectorType = typename SolutionHandler<dim, number>::VectorType;
+  std::vector<Types::Index> accelerated_fields;
+  std::vector<VectorType *> iterate;
+  std::vector<VectorType>   old_iterate;
+  if (anderson_acceleration)
+    {
+      anderson_acceleration->clear();
+      for (const auto &[index, variable] : this->get_subset_attributes())
+        {
+          if (variable.get_pde_type() != PDEType::Auxiliary)
+            {
+              accelerated_fields.push_back(index);
+              iterate.push_back(
+                this->get_solution_handler().get_solution_vector(index,
+                                                                 DependencyType::Normal));
+            }
+        }
+      old_iterate.resize(iterate.size());
+    }
+
   // Set the convergence bool and iteration counter
   bool         unconverged = true;
   unsigned int iteration   = 0;
@@ -135,6 +172,12 @@ SequentialCoNonlinearSolver<dim, degree, number>::solve()
       // Assume the solve is converged, unless proven otherwise
       unconverged = false;
 
+      // Store the iterate before the sweep
+      for (unsigned int block = 0; block < iterate.size(); block++)
+        {
+          old_iterate[block] = *iterate[block];
+        }
+
       for (const auto &[index, variable] : this->get_subset_attributes())
         {
           // Set the step length
@@ -171,10 +214,7 @@ SequentialCoNonlinearSolver<dim, degree, number>::solve()
                 << std::flush;
             }
 
-          if (newton_update_norm > this->get_user_inputs()
-                                     .get_nonlinear_solve_parameters()
-                                     .get_nonlinear_solve_parameters(index)
-                                     .tolerance_value)
+          if (!this->is_nonlinear_solve_converged(variable, newton_update_norm))
             {
               unconverged = true;
             }
@@ -192,6 +232,36 @@ SequentialCoNonlinearSolver<dim, degree, number>::solve()
             }
         }
 
+      // Accelerate the block iteration
+      if (anderson_acceleration && unconverged)
+        {
+          Timer::start_section("Zero ghosts");
+          this->get_solution_handler().zero_out_ghosts();
+          Timer::end_section("Zero ghosts");
+
+          anderson_acceleration->apply(old_iterate, iterate);
+
+          for (unsigned int block = 0; block < iterate.size(); block++)
+            {
+              this->get_constraint_handler()
+                .get_constraint(accelerated_fields[block])
+                .distribute(*iterate[block]);
+            }
+
+          Timer::start_section("Update ghosts");
+          this->get_solution_handler().update_ghosts();
+          Timer::end_section("Update ghosts");
+
+          if (this->get_user_inputs().get_output_parameters().should_output(
+                this->get_user_inputs().get_temporal_discretization().get_increment()))
+            {
+              ConditionalOStreams::pout_summary()
+                << "  Anderson fixed-point residual norm: "
+                << anderson_acceleration->get_residual_l2_norm() << "\n"
+                << std::flush;
+            }
+        }
+
       // Update the iteration counter
       iteration++;
     }
@@ -201,14 +271,10 @@ SequentialCoNonlinearSolver<dim, degree, number>::solve()
     {
       if (variable.get_pde_type() != PDEType::Auxiliary)
         {
-          // The solve will have updated the "old solution" vector with the newton update
-          // so it's technically the new solution. In order to update the solutions and
-          // perserve the old states we copy the old solution from above and swap.
-          *(this->get_solution_handler().get_new_solution_vector(index)) =
-            old_solutions[index];
-          this->get_solution_handler()
-            .get_solution_vector(index, DependencyType::Normal)
-            ->swap(*this->get_solution_handler().get_new_solution_vector(index));
+          // The solve will have updated the solution vector in place with the newton
+          // update, so we only have to rotate the old solutions.
+          this->get_solution_handler().rotate_history(index);
+          continue;
         }
 
       this->get_solution_handler().update(this->get_field_solve_type(),
@@ -228,6 +294,15 @@ SequentialCoNonlinearSolver<dim, degree, number>::print()
 {
   // Print the base class information
   this->SequentialSolver<dim, degree, number>::print();
+
+  if (anderson_acceleration)
+    {
+      ConditionalOStreams::pout_summary()
+        << "  Anderson acceleration depth: "
+        << this->get_user_inputs().get_nonlinear_solve_parameters().get_anderson_depth()
+        << "\n"
+        << std::flush;
+    }
 }
 
 #include "solvers/sequential_co_nonlinear_solver.inst"
@@ -84,9 +84,9 @@ SequentialSelfNonlinearSolver<dim, degree, number>::solve()
   // Solve each field
   for (const auto &[index, variable] : this->get_subset_attributes())
     {
-      // Grab the old solution in a temporary variable
-      const auto old_solution = *(
-        this->get_solution_handler().get_solution_vector(index, DependencyType::Normal));
+      // Store the current solution so it can become the OldOne solution once the solve
+      // has updated it in place
+      this->get_solution_handler().prepare_history(index);
 
       // Set the convergence bool, iteration counter, and step length
       bool         unconverged = true;
@@ -96,6 +96,9 @@ SequentialSelfNonlinearSolver<dim, degree, number>::solve()
                                    .get_nonlinear_solve_parameters(index)
                                    .step_length;
 
+      // Reset the forcing terms and residual history for this nonlinear solve
+      this->get_linear_solver(index).reset_nonlinear_history();
+
       while (unconverged)
         {
           if (this->get_user_inputs().get_output_parameters().should_output(
@@ -124,10 +127,7 @@ SequentialSelfNonlinearSolver<dim, degree, number>::solve()
                 << std::flush;
             }
 
-          if (newton_update_norm > this->get_user_inputs()
-                                     .get_nonlinear_solve_parameters()
-                                     .get_nonlinear_solve_parameters(index)
-                                     .tolerance_value)
+          if (!this->is_nonlinear_solve_converged(variable, newton_update_norm))
             {
               unconverged = true;
             }
@@ -148,18 +148,9 @@ SequentialSelfNonlinearSolver<dim, degree, number>::solve()
           iteration++;
         }
 
-      // The solve will have updated the "old solution" vector with the newton update so
-      // it's technically the new solution. In order to update the solutions and perserve
-      // the old states we copy the old solution from above and swap.
-      *(this->get_solution_handler().get_new_solution_vector(index)) = old_solution;
-      this->get_solution_handler()
-        .get_solution_vector(index, DependencyType::Normal)
-        ->swap(*this->get_solution_handler().get_new_solution_vector(index));
-
-      // Update the solutions
-      this->get_solution_handler().update(this->get_field_solve_type(),
-                                          this->get_solve_block(),
-                                          index);
+      // The solve will have updated the solution vector in place with the newton update,
+      // so we only have to rotate the old solutions.
+      this->get_solution_handler().rotate_history(index);
 
       // Update the ghosts
       Timer::start_section("Update ghosts");
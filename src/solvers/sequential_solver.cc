@@ -1,11 +1,15 @@
 // SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
 // SPDX-License-Identifier: GNU Lesser General Public Version 2.1
 
+#include <deal.II/base/exceptions.h>
+
+#include <prismspf/core/conditional_ostreams.h>
 #include <prismspf/core/matrix_free_operator.h>
 #include <prismspf/core/timer.h>
 #include <prismspf/core/type_enums.h>
 #include <prismspf/core/types.h>
 
+#include <prismspf/solvers/linear_solver_base.h>
 #include <prismspf/solvers/linear_solver_gmg.h>
 #include <prismspf/solvers/linear_solver_identity.h>
 #include <prismspf/solvers/sequential_solver.h>
@@ -318,6 +322,48 @@ SequentialSolver<dim, degree, number>::solve_explicit_solver(
       *(this->get_solution_handler().get_solution_vector(global_field_index,
                                                          DependencyType::Normal)));
 
+  // Update the ghosts of the field, which is the only one that changed
+  Timer::start_section("Update ghosts");
+  this->get_solution_handler().update_ghosts(global_field_index);
+  Timer::end_section("Update ghosts");
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+SequentialSolver<dim, degree, number>::evaluate_explicit_solver(
+  const VariableAttributes &variable)
+{
+  // Zero out the ghosts
+  Timer::start_section("Zero ghosts");
+  this->get_solution_handler().zero_out_ghosts();
+  Timer::end_section("Zero ghosts");
+
+  // Grab the global field index
+  const Types::Index global_field_index = variable.get_field_index();
+
+  // Compute the update
+  system_matrix[global_field_index]->compute_nonexplicit_auxiliary_update(
+    new_solution_subset.at(global_field_index),
+    solution_subset.at(global_field_index));
+
+  // Scale the update by the respective (Scalar/Vector) invm.
+  new_solution_subset.at(global_field_index)
+    .at(0)
+    ->scale(this->get_invm_handler().get_invm(global_field_index));
+
+  // Swap the update into the solution. Unlike SolutionHandler::update(), this leaves the
+  // old solutions untouched.
+  this->get_solution_handler()
+    .get_solution_vector(global_field_index, DependencyType::Normal)
+    ->swap(*new_solution_subset.at(global_field_index).at(0));
+
+  // Apply constraints
+  this->get_constraint_handler()
+    .get_constraint(global_field_index)
+    .distribute(
+      *(this->get_solution_handler().get_solution_vector(global_field_index,
+                                                         DependencyType::Normal)));
+
   // Update the ghosts
   Timer::start_section("Update ghosts");
   this->get_solution_handler().update_ghosts();
@@ -329,11 +375,6 @@ void
 SequentialSolver<dim, degree, number>::solve_linear_solver(
   const VariableAttributes &variable)
 {
-  // Grab the old solution in a temporary variable
-  const auto old_solution =
-    *(this->get_solution_handler().get_solution_vector(variable.get_field_index(),
-                                                       DependencyType::Normal));
-
   // Zero out the ghosts
   Timer::start_section("Zero ghosts");
   this->get_solution_handler().zero_out_ghosts();
@@ -349,6 +390,10 @@ SequentialSolver<dim, degree, number>::solve_linear_solver(
       return;
     }
 
+  // Store the current solution so it can become the OldOne solution once the solve has
+  // updated it in place
+  this->get_solution_handler().prepare_history(global_field_index);
+
   if (this->get_user_inputs()
         .get_linear_solve_parameters()
         .get_linear_solve_parameters(global_field_index)
@@ -361,20 +406,9 @@ SequentialSolver<dim, degree, number>::solve_linear_solver(
       identity_solvers.at(global_field_index)->solve();
     }
 
-  // The solve will have updated the "old solution" vector with the newton update so it's
-  // technically the new solution. In order to update the solutions and perserve the old
-  // states we copy the old solution from above and swap.
-  *(this->get_solution_handler().get_new_solution_vector(variable.get_field_index())) =
-    old_solution;
-  this->get_solution_handler()
-    .get_solution_vector(variable.get_field_index(), DependencyType::Normal)
-    ->swap(
-      *this->get_solution_handler().get_new_solution_vector(variable.get_field_index()));
-
-  // Update the solutions
-  this->get_solution_handler().update(this->get_field_solve_type(),
-                                      this->get_solve_block(),
-                                      global_field_index);
+  // The solve will have updated the solution vector in place with the newton update, so
+  // we only have to rotate the old solutions.
+  this->get_solution_handler().rotate_history(global_field_index);
 
   // Update the ghosts
   Timer::start_section("Update ghosts");
@@ -426,6 +460,57 @@ SequentialSolver<dim, degree, number>::solve_linear_solver(
   return identity_solvers.at(global_field_index)->get_newton_update_l2_norm();
 }
 
+template <unsigned int dim, unsigned int degree, typename number>
+bool
+SequentialSolver<dim, degree, number>::is_nonlinear_solve_converged(
+  const VariableAttributes &variable,
+  const number             &newton_update_norm)
+{
+  if (variable.get_pde_type() == PDEType::Auxiliary)
+    {
+      return true;
+    }
+
+  // Grab the global field index
+  const Types::Index global_field_index = variable.get_field_index();
+
+  const auto &linear_solver = this->get_linear_solver(global_field_index);
+  const auto &nonlinear_parameters = this->get_user_inputs()
+                                       .get_nonlinear_solve_parameters()
+                                       .get_nonlinear_solve_parameters(global_field_index);
+
+  if (nonlinear_parameters.requires_updated_residual() &&
+      this->get_user_inputs().get_output_parameters().should_output(
+        this->get_user_inputs().get_temporal_discretization().get_increment()))
+    {
+      ConditionalOStreams::pout_summary()
+        << "  field: " << global_field_index
+        << " Nonlinear residual norm: " << linear_solver.get_updated_residual_l2_norm()
+        << "\n"
+        << std::flush;
+    }
+
+  return nonlinear_parameters.is_converged(newton_update_norm,
+                                           linear_solver.get_updated_residual_l2_norm(),
+                                           linear_solver.get_initial_residual_l2_norm());
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+LinearSolverBase<dim, degree, number> &
+SequentialSolver<dim, degree, number>::get_linear_solver(Types::Index global_field_index)
+{
+  if (this->get_user_inputs()
+        .get_linear_solve_parameters()
+        .get_linear_solve_parameters(global_field_index)
+        .preconditioner == PreconditionerType::GMG)
+    {
+      Assert(gmg_solvers.contains(global_field_index), dealii::ExcNotInitialized());
+      return *gmg_solvers.at(global_field_index);
+    }
+  Assert(identity_solvers.contains(global_field_index), dealii::ExcNotInitialized());
+  return *identity_solvers.at(global_field_index);
+}
+
 #include "solvers/sequential_solver.inst"
 
 PRISMS_PF_END_NAMESPACE
\ No newline at end of file
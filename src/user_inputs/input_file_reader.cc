@@ -298,6 +298,56 @@ InputFileReader::declare_mesh()
     "2147483647",
     dealii::Patterns::Integer(1, INT_MAX),
     "The number of time steps between mesh refinement operations.");
+  parameter_handler.declare_entry(
+    "remeshing trigger",
+    "period",
+    dealii::Patterns::Selection("period|event"),
+    "What triggers mesh refinement. With period, the mesh is refined every remeshing "
+    "period steps. With event, the mesh is also refined on any step where the "
+    "refinement criteria are met on the cells next to the region at the max refinement "
+    "level.");
+  parameter_handler.declare_entry(
+    "refinement buffer layers",
+    "0",
+    dealii::Patterns::Integer(0, INT_MAX),
+    "The number of neighbor layers that are refined around the cells that meet the "
+    "refinement criteria. This cannot be used with the fixed_number marking strategy.");
+  parameter_handler.declare_entry(
+    "refinement marking strategy",
+    "threshold",
+    dealii::Patterns::Selection("threshold|fixed_fraction|fixed_number"),
+    "The strategy used to mark cells for refinement and coarsening. The threshold "
+    "strategy is used with the value and gradient criteria, while the fixed_fraction "
+    "and fixed_number strategies are used with the kelly and curvature criteria.");
+  parameter_handler.declare_entry("refine fraction",
+                                  "0.3",
+                                  dealii::Patterns::Double(0.0, 1.0),
+                                  "The fraction of the cells (fixed_number) or of the "
+                                  "total error (fixed_fraction) to refine.");
+  parameter_handler.declare_entry("coarsen fraction",
+                                  "0.03",
+                                  dealii::Patterns::Double(0.0, 1.0),
+                                  "The fraction of the cells (fixed_number) or of the "
+                                  "total error (fixed_fraction) to coarsen.");
+  parameter_handler.declare_entry(
+    "max number of cells",
+    "2147483647",
+    dealii::Patterns::Integer(1, INT_MAX),
+    "The maximum number of cells for the fixed_number marking strategy.");
+  parameter_handler.declare_entry(
+    "cell weighting",
+    "none",
+    dealii::Patterns::Selection("none|user|measured"),
+    "The source of the cell weights used to partition the mesh. With none, the mesh is "
+    "repartitioned by cell count every time it is refined. With user or measured, the "
+    "weights come from the PDE operator or the measured cost of each cell and the mesh "
+    "is only repartitioned when the load imbalance exceeds the threshold.");
+  parameter_handler.declare_entry(
+    "repartition imbalance threshold",
+    "1.1",
+    dealii::Patterns::Double(1.0, DBL_MAX),
+    "The ratio of the maximum to the average load above which the mesh is "
+    "repartitioned.");
 
   for (const auto &[index, variable] : *var_attributes)
     {
@@ -308,9 +358,11 @@ InputFileReader::declare_mesh()
         parameter_handler.declare_entry(
           "type",
           "none",
-          dealii::Patterns::Selection("none|value|gradient|value_and_gradient"),
+          dealii::Patterns::Selection(
+            "none|value|gradient|value_and_gradient|kelly|curvature"),
           "The type of criterion used to determine if a cell should be "
-          "refined. The options are none, value, gradient, value_and_gradient.");
+          "refined. The options are none, value, gradient, value_and_gradient, kelly, "
+          "curvature.");
         parameter_handler.declare_entry(
           "value lower bound",
           "0.0",
@@ -349,6 +401,14 @@ InputFileReader::declare_time_discretization()
     "0.0",
     dealii::Patterns::Double(0.0, DBL_MAX),
     "The value of simulated time where the simulation ends.");
+  parameter_handler.declare_entry(
+    "max time step retries",
+    "0",
+    dealii::Patterns::Integer(0, 16),
+    "The number of times an increment that gives a non-finite (NaN or Inf) solution is "
+    "rolled back and retried. Each retry splits the increment into twice as many "
+    "substeps. If 0, the simulation stops with an error at the first non-finite "
+    "solution.");
 }
 
 void
@@ -424,17 +484,20 @@ InputFileReader::declare_solver_parameters()
                                             "iterations before the loop is stopped.");
             parameter_handler.declare_entry(
               "tolerance type",
-              "AbsoluteResidual",
-              dealii::Patterns::Selection("AbsoluteResidual|RelativeResidualChange"),
-              "The tolerance type for the nonlinear solver.");
+              "AbsoluteSolutionChange",
+              dealii::Patterns::Selection(
+                "AbsoluteResidual|RelativeResidualChange|AbsoluteSolutionChange"),
+              "The tolerance type for the nonlinear solver. AbsoluteResidual and "
+              "RelativeResidualChange compare the l2-norm of the nonlinear residual, "
+              "while AbsoluteSolutionChange compares the l2-norm of the newton update.");
             parameter_handler.declare_entry(
               "tolerance value",
-              "1.0e-10",
+              "1.0e-6",
               dealii::Patterns::Double(DBL_MIN, DBL_MAX),
               "The value of for the nonlinear solver tolerance.");
             parameter_handler.declare_entry(
               "use backtracking line search",
-              "true",
+              "false",
               dealii::Patterns::Bool(),
               "Whether to use a backtracking line-search to find the best "
               "choice of the damping coefficient.");
@@ -446,20 +509,88 @@ InputFileReader::declare_solver_parameters()
               "per backtrack. The 'tau' parameter.");
             parameter_handler.declare_entry(
               "residual decrease coefficient",
-              "0.5",
+              "1.0e-4",
               dealii::Patterns::Double(0.0, 1.0),
               "The constant that determines how much the residual must "
               "decrease to be accepted as sufficient. The 'c' parameter.");
+            parameter_handler.declare_entry(
+              "max backtracks",
+              "10",
+              dealii::Patterns::Integer(1, INT_MAX),
+              "The maximum number of backtracks per nonlinear iteration before the "
+              "step is accepted regardless of the residual decrease.");
             parameter_handler.declare_entry(
               "step size",
               "1.0",
               dealii::Patterns::Double(0.0, 1.0),
               "The constant damping value to be used if the backtrace "
               "line-search approach isn't used.");
+            parameter_handler.declare_entry(
+              "use eisenstat walker",
+              "false",
+              dealii::Patterns::Bool(),
+              "Whether to use Eisenstat-Walker forcing terms to adaptively set the "
+              "linear solver tolerance of each Newton iteration.");
+            parameter_handler.declare_entry(
+              "initial forcing term",
+              "0.5",
+              dealii::Patterns::Double(0.0, 1.0),
+              "The forcing term used for the first Newton iteration.");
+            parameter_handler.declare_entry("max forcing term",
+                                            "0.9",
+                                            dealii::Patterns::Double(0.0, 1.0),
+                                            "The upper bound for the forcing term.");
+            parameter_handler.declare_entry(
+              "forcing term gamma",
+              "0.9",
+              dealii::Patterns::Double(0.0, 1.0),
+              "The constant that scales the ratio of successive residual norms. The "
+              "'gamma' parameter.");
+            parameter_handler.declare_entry(
+              "forcing term alpha",
+              "1.618",
+              dealii::Patterns::Double(1.0, 2.0),
+              "The exponent applied to the ratio of successive residual norms. The "
+              "'alpha' parameter.");
           }
           parameter_handler.leave_subsection();
         }
     }
+
+  // For the co-nonlinear block iteration
+  parameter_handler.declare_entry(
+    "anderson acceleration depth",
+    "0",
+    dealii::Patterns::Integer(0, INT_MAX),
+    "The number of previous iterates used to accelerate the co-nonlinear block "
+    "iteration. A depth of zero disables Anderson acceleration.");
+  parameter_handler.declare_entry(
+    "anderson mixing parameter",
+    "1.0",
+    dealii::Patterns::Double(0.0, 1.0),
+    "The mixing parameter for Anderson acceleration. The 'beta' parameter.");
+  parameter_handler.declare_entry(
+    "use monolithic co-nonlinear solve",
+    "false",
+    dealii::Patterns::Bool(),
+    "Whether to solve the co-nonlinear fields as one block system with a "
+    "block-preconditioned GMRES solver instead of field by field.");
+  parameter_handler.declare_entry(
+    "monolithic linear tolerance",
+    "1.0e-6",
+    dealii::Patterns::Double(0.0, 1.0),
+    "The relative tolerance of the GMRES solve of the monolithic co-nonlinear system.");
+  parameter_handler.declare_entry(
+    "monolithic linear max iterations",
+    "200",
+    dealii::Patterns::Integer(1, INT_MAX),
+    "The maximum number of GMRES iterations of the monolithic co-nonlinear system.");
+  parameter_handler.declare_entry(
+    "monolithic linear restart length",
+    "50",
+    dealii::Patterns::Integer(1, INT_MAX),
+    "The number of GMRES iterations between restarts of the monolithic co-nonlinear "
+    "system. GMRES stores this many Krylov vectors of the block system.");
 }
 
 void
@@ -474,13 +605,72 @@ InputFileReader::declare_output_parameters()
                                     "time step and processor info are added.");
     parameter_handler.declare_entry("file type",
                                     "vtu",
-                                    dealii::Patterns::Selection("vtu|vtk|pvtu"),
-                                    "The output file type (either vtu, pvtu, or vtk).");
+                                    dealii::Patterns::Selection("vtu|vtk|pvtu|hdf5"),
+                                    "The output file type (either vtu, pvtu, vtk, or "
+                                    "hdf5). The hdf5 type writes one shared file per "
+                                    "output step and an XDMF file that indexes them.");
     parameter_handler.declare_entry(
       "subdivisions",
       "0",
       dealii::Patterns::Integer(0, INT_MAX),
       "The number of subdivisions to apply to the mesh when building output patches.");
+    parameter_handler.declare_entry(
+      "higher order cells",
+      "false",
+      dealii::Patterns::Bool(),
+      "Whether to write each cell as a single VTK Lagrange cell instead of subdividing "
+      "it into linear cells. This requires the vtu, pvtu, or vtk file type.");
+    parameter_handler.declare_entry(
+      "compression level",
+      "best_speed",
+      dealii::Patterns::Selection(
+        "no_compression|best_speed|default_compression|best_compression"),
+      "The zlib compression level of the output files, when PRISMS-PF is built with "
+      "zlib.");
+    parameter_handler.declare_entry(
+      "asynchronous",
+      "false",
+      dealii::Patterns::Bool(),
+      "Whether to write the output on a background thread while the solver keeps "
+      "stepping. This requires the pvtu or vtk file type.");
+    parameter_handler.declare_entry(
+      "buffers",
+      "2",
+      dealii::Patterns::Integer(1, INT_MAX),
+      "The number of solution snapshots that can wait to be written with asynchronous "
+      "output.");
+    parameter_handler.declare_entry(
+      "postprocessed fields only",
+      "false",
+      dealii::Patterns::Bool(),
+      "Whether to only write the postprocessed fields.");
+    parameter_handler.declare_entry(
+      "isosurface fields",
+      "",
+      dealii::Patterns::List(dealii::Patterns::Anything()),
+      "The scalar fields whose isosurfaces (isolines in 2D) are extracted with marching "
+      "cubes and written to vtp files, with a pvtp record, at every output.");
+    parameter_handler.declare_entry(
+      "isosurface values",
+      "0.5",
+      dealii::Patterns::List(dealii::Patterns::Double(), 0, INT_MAX, ","),
+      "The values of the isosurfaces of each isosurface field.");
+    parameter_handler.declare_entry(
+      "isosurfaces only",
+      "false",
+      dealii::Patterns::Bool(),
+      "Whether to only write the isosurfaces, without the full fields.");
+    parameter_handler.declare_entry(
+      "region lower corner",
+      "",
+      dealii::Patterns::List(dealii::Patterns::Double(), 0, 3, ","),
+      "The lower corner of the region of interest. Only the cells that intersect the "
+      "region are written. If empty, the whole domain is written.");
+    parameter_handler.declare_entry(
+      "region upper corner",
+      "",
+      dealii::Patterns::List(dealii::Patterns::Double(), 0, 3, ","),
+      "The upper corner of the region of interest.");
     parameter_handler.declare_entry(
       "condition",
       "EQUAL_SPACING",
@@ -508,6 +698,31 @@ InputFileReader::declare_output_parameters()
       dealii::Patterns::Bool(),
       "Whether to print the summary table of the wall time and wall time for "
       "indiviual subroutines every time the code outputs.");
+    parameter_handler.declare_entry(
+      "statistics",
+      "integral, l2 norm, min, max",
+      dealii::Patterns::MultipleSelection(
+        "integral|l2 norm|min|max|mean|phase fraction|interface area"),
+      "The statistics of each field that are printed with the output and written to "
+      "the statistics log. For vector fields, the min and max are of the magnitude. "
+      "The phase fraction and interface area are only computed for scalar fields. The "
+      "phase fraction is the volume fraction where the field exceeds the phase "
+      "fraction threshold. The interface area is the integral of the magnitude of the "
+      "gradient, which is the area of the interface for an order parameter that goes "
+      "from 0 to 1 across it.");
+    parameter_handler.declare_entry(
+      "phase fraction threshold",
+      "0.5",
+      dealii::Patterns::Double(-DBL_MAX, DBL_MAX),
+      "The value of a field above which a point belongs to the phase, used for the "
+      "phase fraction statistic.");
+    parameter_handler.declare_entry(
+      "statistics period",
+      "0",
+      dealii::Patterns::Integer(0, INT_MAX),
+      "The number of time steps between entries of the statistics time series in "
+      "statistics.csv, independent of the output of the solution fields. If 0, the "
+      "time series is not written.");
   }
   parameter_handler.leave_subsection();
 }
@@ -580,6 +795,34 @@ InputFileReader::declare_checkpoint_parameters()
       dealii::Patterns::Integer(0, INT_MAX),
       "The number of checkpoints (or number of checkpoints per decade for the "
       "N_PER_DECADE type).");
+    parameter_handler.declare_entry(
+      "fast directory",
+      "",
+      dealii::Patterns::Anything(),
+      "A directory on fast shared storage (e.g., a burst buffer) where the checkpoints "
+      "are written first. It must be visible to every process. The "
+      "checkpoints are then copied to the working directory in the background. If "
+      "empty, the checkpoints are written to the working directory.");
+    parameter_handler.declare_entry(
+      "flush period",
+      "1",
+      dealii::Patterns::Integer(1, INT_MAX),
+      "With a fast directory, the number of checkpoints between copies to the working "
+      "directory.");
+    parameter_handler.declare_entry(
+      "number to keep",
+      "0",
+      dealii::Patterns::Integer(0, INT_MAX),
+      "The number of most recent checkpoints to keep in each directory. Older ones are "
+      "deleted. If 0, every checkpoint is kept.");
+    parameter_handler.declare_entry(
+      "max wall time",
+      "0",
+      dealii::Patterns::Double(0.0, DBL_MAX),
+      "The wall time in seconds after which the simulation writes a checkpoint and "
+      "stops. The simulation stops early enough to finish the checkpoint, based on the "
+      "measured cost of the checkpoints and the recent time per increment. A SIGTERM or "
+      "SIGUSR1 signal stops the simulation the same way. If 0, there is no limit.");
   }
   parameter_handler.leave_subsection();
 }
@@ -55,7 +55,9 @@ UserInputParameters<dim>::UserInputParameters(InputFileReader          &input_fi
   temporal_discretization.postprocess_and_validate(var_attributes);
   linear_solve_parameters.postprocess_and_validate();
   nonlinear_solve_parameters.postprocess_and_validate();
-  output_parameters.postprocess_and_validate(temporal_discretization);
+  output_parameters.postprocess_and_validate(temporal_discretization,
+                                             dim,
+                                             var_attributes);
   checkpoint_parameters.postprocess_and_validate(temporal_discretization);
   boundary_parameters.postprocess_and_validate(var_attributes);
   load_ic_parameters.postprocess_and_validate();
@@ -114,6 +116,68 @@ UserInputParameters<dim>::assign_spatial_discretization_parameters(
   spatial_discretization.set_min_refinement(
     parameter_handler.get_integer("min refinement"));
 
+  const std::string remeshing_trigger_string = parameter_handler.get("remeshing trigger");
+  if (boost::iequals(remeshing_trigger_string, "period"))
+    {
+      spatial_discretization.set_remeshing_trigger(GridRefinement::Period);
+    }
+  else if (boost::iequals(remeshing_trigger_string, "event"))
+    {
+      spatial_discretization.set_remeshing_trigger(GridRefinement::Event);
+    }
+  else
+    {
+      AssertThrow(false, UnreachableCode());
+    }
+
+  spatial_discretization.set_refinement_buffer_layers(
+    parameter_handler.get_integer("refinement buffer layers"));
+
+  const std::string marking_strategy_string =
+    parameter_handler.get("refinement marking strategy");
+  if (boost::iequals(marking_strategy_string, "threshold"))
+    {
+      spatial_discretization.set_marking_strategy(GridRefinement::Threshold);
+    }
+  else if (boost::iequals(marking_strategy_string, "fixed_fraction"))
+    {
+      spatial_discretization.set_marking_strategy(GridRefinement::FixedFraction);
+    }
+  else if (boost::iequals(marking_strategy_string, "fixed_number"))
+    {
+      spatial_discretization.set_marking_strategy(GridRefinement::FixedNumber);
+    }
+  else
+    {
+      AssertThrow(false, UnreachableCode());
+    }
+  spatial_discretization.set_refine_fraction(
+    parameter_handler.get_double("refine fraction"));
+  spatial_discretization.set_coarsen_fraction(
+    parameter_handler.get_double("coarsen fraction"));
+  spatial_discretization.set_max_number_of_cells(
+    parameter_handler.get_integer("max number of cells"));
+
+  const std::string cell_weighting_string = parameter_handler.get("cell weighting");
+  if (boost::iequals(cell_weighting_string, "none"))
+    {
+      spatial_discretization.set_cell_weighting(GridRefinement::Uniform);
+    }
+  else if (boost::iequals(cell_weighting_string, "user"))
+    {
+      spatial_discretization.set_cell_weighting(GridRefinement::User);
+    }
+  else if (boost::iequals(cell_weighting_string, "measured"))
+    {
+      spatial_discretization.set_cell_weighting(GridRefinement::Measured);
+    }
+  else
+    {
+      AssertThrow(false, UnreachableCode());
+    }
+  spatial_discretization.set_imbalance_threshold(
+    parameter_handler.get_double("repartition imbalance threshold"));
+
   for (const auto &[index, variable] : var_attributes)
     {
       std::string subsection_text = "refinement criterion: ";
@@ -143,6 +207,14 @@ UserInputParameters<dim>::assign_spatial_discretization_parameters(
                 new_criterion.set_criterion(GridRefinement::RefinementFlags::Value |
                                             GridRefinement::RefinementFlags::Gradient);
               }
+            else if (boost::iequals(crit_type_string, "kelly"))
+              {
+                new_criterion.set_criterion(GridRefinement::RefinementFlags::Kelly);
+              }
+            else if (boost::iequals(crit_type_string, "curvature"))
+              {
+                new_criterion.set_criterion(GridRefinement::RefinementFlags::Curvature);
+              }
             else
               {
                 AssertThrow(false, UnreachableCode());
@@ -163,6 +235,8 @@ UserInputParameters<dim>::assign_temporal_discretization_parameters(
   temporal_discretization.set_final_time(parameter_handler.get_double("end time"));
   temporal_discretization.set_total_increments(
     static_cast<unsigned int>(parameter_handler.get_integer("number steps")));
+  temporal_discretization.set_max_retries(
+    static_cast<unsigned int>(parameter_handler.get_integer("max time step retries")));
 }
 
 template <unsigned int dim>
@@ -176,6 +250,50 @@ UserInputParameters<dim>::assign_output_parameters(
     output_parameters.set_file_type(parameter_handler.get("file type"));
     output_parameters.set_patch_subdivisions(
       parameter_handler.get_integer("subdivisions"));
+    output_parameters.set_write_higher_order_cells(
+      parameter_handler.get_bool("higher order cells"));
+    const std::string compression_level_string =
+      parameter_handler.get("compression level");
+    if (boost::iequals(compression_level_string, "no_compression"))
+      {
+        output_parameters.set_compression_level(
+          dealii::DataOutBase::CompressionLevel::no_compression);
+      }
+    else if (boost::iequals(compression_level_string, "best_speed"))
+      {
+        output_parameters.set_compression_level(
+          dealii::DataOutBase::CompressionLevel::best_speed);
+      }
+    else if (boost::iequals(compression_level_string, "default_compression"))
+      {
+        output_parameters.set_compression_level(
+          dealii::DataOutBase::CompressionLevel::default_compression);
+      }
+    else if (boost::iequals(compression_level_string, "best_compression"))
+      {
+        output_parameters.set_compression_level(
+          dealii::DataOutBase::CompressionLevel::best_compression);
+      }
+    else
+      {
+        AssertThrow(false, UnreachableCode());
+      }
+    output_parameters.set_asynchronous_output(parameter_handler.get_bool("asynchronous"));
+    output_parameters.set_n_buffers(
+      static_cast<unsigned int>(parameter_handler.get_integer("buffers")));
+    output_parameters.set_postprocessed_only(
+      parameter_handler.get_bool("postprocessed fields only"));
+    output_parameters.set_isosurface_fields(
+      dealii::Utilities::split_string_list(parameter_handler.get("isosurface fields")));
+    output_parameters.set_isosurface_values(dealii::Utilities::string_to_double(
+      dealii::Utilities::split_string_list(parameter_handler.get("isosurface values"))));
+    output_parameters.set_isosurfaces_only(
+      parameter_handler.get_bool("isosurfaces only"));
+    output_parameters.set_output_region(
+      dealii::Utilities::string_to_double(dealii::Utilities::split_string_list(
+        parameter_handler.get("region lower corner"))),
+      dealii::Utilities::string_to_double(dealii::Utilities::split_string_list(
+        parameter_handler.get("region upper corner"))));
     output_parameters.set_output_condition(parameter_handler.get("condition"));
     output_parameters.set_user_output_list(dealii::Utilities::string_to_int(
       dealii::Utilities::split_string_list(parameter_handler.get("list"))));
@@ -185,6 +303,12 @@ UserInputParameters<dim>::assign_output_parameters(
       parameter_handler.get_integer("print step period"));
     output_parameters.set_print_timing_with_output(
       parameter_handler.get_bool("timing information with output"));
+    output_parameters.set_statistics(
+      dealii::Utilities::split_string_list(parameter_handler.get("statistics")));
+    output_parameters.set_statistics_period(
+      static_cast<unsigned int>(parameter_handler.get_integer("statistics period")));
+    output_parameters.set_phase_fraction_threshold(
+      parameter_handler.get_double("phase fraction threshold"));
   }
   parameter_handler.leave_subsection();
 }
@@ -203,6 +327,13 @@ UserInputParameters<dim>::assign_checkpoint_parameters(
       dealii::Utilities::split_string_list(parameter_handler.get("list"))));
     checkpoint_parameters.set_n_checkpoints(
       static_cast<unsigned int>(parameter_handler.get_integer("number")));
+    checkpoint_parameters.set_fast_directory(parameter_handler.get("fast directory"));
+    checkpoint_parameters.set_flush_period(
+      static_cast<unsigned int>(parameter_handler.get_integer("flush period")));
+    checkpoint_parameters.set_n_kept_checkpoints(
+      static_cast<unsigned int>(parameter_handler.get_integer("number to keep")));
+    checkpoint_parameters.set_max_wall_time(
+      parameter_handler.get_double("max wall time"));
   }
   parameter_handler.leave_subsection();
 }
@@ -369,14 +500,69 @@ UserInputParameters<dim>::assign_nonlinear_solve_parameters(
             parameter_handler.get_integer("max iterations");
           nonlinear_solver_parameters.step_length =
             parameter_handler.get_double("step size");
+
+          // Set the tolerance type
+          const std::string type_string = parameter_handler.get("tolerance type");
+          if (boost::iequals(type_string, "AbsoluteResidual"))
+            {
+              nonlinear_solver_parameters.tolerance_type =
+                SolverToleranceType::AbsoluteResidual;
+            }
+          else if (boost::iequals(type_string, "RelativeResidualChange"))
+            {
+              nonlinear_solver_parameters.tolerance_type =
+                SolverToleranceType::RelativeResidualChange;
+            }
+          else if (boost::iequals(type_string, "AbsoluteSolutionChange"))
+            {
+              nonlinear_solver_parameters.tolerance_type =
+                SolverToleranceType::AbsoluteSolutionChange;
+            }
+          else
+            {
+              AssertThrow(false, UnreachableCode());
+            }
+
+          // Set the tolerance value
+          nonlinear_solver_parameters.tolerance_value =
+            parameter_handler.get_double("tolerance value");
+
+          // Set the backtracking line search parameters
+          nonlinear_solver_parameters.use_backtracking_line_search =
+            parameter_handler.get_bool("use backtracking line search");
+          nonlinear_solver_parameters.step_size_modifier =
+            parameter_handler.get_double("step size modifier");
+          nonlinear_solver_parameters.residual_decrease_coefficient =
+            parameter_handler.get_double("residual decrease coefficient");
+          nonlinear_solver_parameters.max_backtracks =
+            parameter_handler.get_integer("max backtracks");
+
+          // Set the Eisenstat-Walker forcing term parameters
+          nonlinear_solver_parameters.use_eisenstat_walker =
+            parameter_handler.get_bool("use eisenstat walker");
+          nonlinear_solver_parameters.initial_forcing_term =
+            parameter_handler.get_double("initial forcing term");
+          nonlinear_solver_parameters.max_forcing_term =
+            parameter_handler.get_double("max forcing term");
+          nonlinear_solver_parameters.forcing_term_gamma =
+            parameter_handler.get_double("forcing term gamma");
+          nonlinear_solver_parameters.forcing_term_alpha =
+            parameter_handler.get_double("forcing term alpha");
           nonlinear_solve_parameters
             .set_nonlinear_solve_parameters(index, nonlinear_solver_parameters);
 
-          // TODO (landinjm): Implement backtracking line search
-
           parameter_handler.leave_subsection();
         }
     }
+
+  nonlinear_solve_parameters.set_anderson_acceleration_parameters(
+    parameter_handler.get_integer("anderson acceleration depth"),
+    parameter_handler.get_double("anderson mixing parameter"));
+  nonlinear_solve_parameters.set_monolithic_parameters(
+    parameter_handler.get_bool("use monolithic co-nonlinear solve"),
+    parameter_handler.get_double("monolithic linear tolerance"),
+    parameter_handler.get_integer("monolithic linear max iterations"),
+    parameter_handler.get_integer("monolithic linear restart length"));
 }
 
 template <unsigned int dim>
@@ -2,11 +2,8 @@
 // SPDX-License-Identifier: GNU Lesser General Public Version 2.1
 
 #include <deal.II/base/exceptions.h>
-#include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/vectorization.h>
-#include <deal.II/fe/fe_system.h>
-#include <deal.II/fe/fe_update_flags.h>
-#include <deal.II/fe/fe_values.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
 #include <deal.II/matrix_free/matrix_free.h>
 
 #include <prismspf/core/conditional_ostreams.h>
@@ -19,6 +16,7 @@
 #include <prismspf/config.h>
 
 #include <memory>
+#include <vector>
 
 PRISMS_PF_BEGIN_NAMESPACE
 
@@ -42,40 +40,25 @@ ElementVolume<dim, degree, number>::compute_element_volume()
   // Resize vector
   element_volume.resize(n_cells);
 
-  // Set quadrature rule and FEValues to update the JxW values
-  const dealii::QGaussLobatto<dim> quadrature(degree + 1);
-  dealii::FEValues<dim>            fe_values(data->get_dof_handler().get_fe(),
-                                  quadrature,
-                                  dealii::update_JxW_values);
+  // Reset the cell batch costs since the cell batches have changed
+  cell_batch_cost.assign(record_cell_batch_cost ? n_cells : 0, 0.0);
 
-  // Get the number of quadrature points
-  const unsigned int num_quad_points = quadrature.size();
-
-  // Loop over the cells and each lane in the vectorized array
+  // Sum up the JxW values at each quadrature point to compute the element volume in 3D
+  // or area in 2D. The mapping data is precomputed by the matrix-free object, so all
+  // lanes of a cell batch are done at once without reinitializing any cells.
+  dealii::FEEvaluation<dim, degree, degree + 1, 1, number> fe_eval(*data);
   for (unsigned int cell = 0; cell < n_cells; cell++)
     {
-      for (unsigned int lane = 0; lane < data->n_active_entries_per_cell_batch(cell);
-           lane++)
-        {
-          // Get the iterator for the cell
-          auto cell_iterator = data->get_cell_iterator(cell, lane);
-
-          // Reinitialize the cell
-          fe_values.reinit(cell_iterator);
-
-          // Initialize volume to 0 for the cell
-          number cell_volume = 0.0;
+      fe_eval.reinit(cell);
 
-          // Sum up the JxW values at each quadrature point to compute the element volume
-          // in 3D or area in 2D.
-          for (unsigned int q_point = 0; q_point < num_quad_points; ++q_point)
-            {
-              cell_volume += fe_values.JxW(q_point);
-            }
-
-          // Store the element volume
-          element_volume[cell][lane] = cell_volume;
+      dealii::VectorizedArray<number> cell_volume(0.0);
+      for (const unsigned int q_point : fe_eval.quadrature_point_indices())
+        {
+          cell_volume += fe_eval.JxW(q_point);
         }
+
+      // Store the element volume
+      element_volume[cell] = cell_volume;
     }
 }
 
@@ -92,6 +75,34 @@ ElementVolume<dim, degree, number>::get_element_volume(unsigned cell) const
   return element_volume[cell];
 };
 
+template <unsigned int dim, unsigned int degree, typename number>
+void
+ElementVolume<dim, degree, number>::set_record_cell_batch_cost(
+  bool _record_cell_batch_cost)
+{
+  record_cell_batch_cost = _record_cell_batch_cost;
+  cell_batch_cost.assign(record_cell_batch_cost ? element_volume.size() : 0, 0.0);
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+ElementVolume<dim, degree, number>::add_cell_batch_cost(unsigned int cell,
+                                                        double       cost) const
+{
+  Assert(record_cell_batch_cost,
+         dealii::ExcMessage("The cell batch cost is not being recorded"));
+  Assert(cell_batch_cost.size() > cell,
+         dealii::ExcIndexRange(cell, 0, cell_batch_cost.size()));
+  cell_batch_cost[cell] += cost;
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+const std::vector<double> &
+ElementVolume<dim, degree, number>::get_cell_batch_cost() const
+{
+  return cell_batch_cost;
+}
+
 template <unsigned int dim, unsigned int degree, typename number>
 ElementVolumeContainer<dim, degree, number>::ElementVolumeContainer(MGInfo<dim> &mg_info)
   : element_volume()
@@ -163,6 +174,14 @@ ElementVolumeContainer<dim, degree, number>::get_element_volume() const
   return element_volume;
 }
 
+template <unsigned int dim, unsigned int degree, typename number>
+void
+ElementVolumeContainer<dim, degree, number>::set_record_cell_batch_cost(
+  bool record_cell_batch_cost)
+{
+  element_volume.set_record_cell_batch_cost(record_cell_batch_cost);
+}
+
 template <unsigned int dim, unsigned int degree, typename number>
 const ElementVolume<dim, degree, float> &
 ElementVolumeContainer<dim, degree, number>::get_mg_element_volume(
@@ -2,135 +2,219 @@
 // SPDX-License-Identifier: GNU Lesser General Public Version 2.1
 
 #include <deal.II/base/exceptions.h>
-#include <deal.II/base/quadrature_lib.h>
-#include <deal.II/dofs/dof_handler.h>
-#include <deal.II/fe/fe_update_flags.h>
-#include <deal.II/fe/fe_values.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/vectorization.h>
 #include <deal.II/lac/vector.h>
+#include <deal.II/matrix_free/evaluation_flags.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
 
 #include <prismspf/utilities/integrator.h>
 
 #include <prismspf/config.h>
 
+#include <array>
+#include <map>
+#include <memory>
 #include <mpi.h>
+#include <utility>
 #include <vector>
 
 PRISMS_PF_BEGIN_NAMESPACE
 
 template <unsigned int dim, unsigned int degree, typename number>
 void
-Integrator<dim, degree, number>::compute_integral(
-  number                        &integral_value,
-  const dealii::DoFHandler<dim> &dof_handler,
-  const VectorType              &vector) const
+Integrator<dim, degree, number>::initialize(
+  std::shared_ptr<dealii::MatrixFree<dim, number, SizeType>> _data)
 {
+  data = _data;
+}
+
+template <unsigned int dim, unsigned int degree, typename number>
+void
+Integrator<dim, degree, number>::compute_integral(double           &integral_value,
+                                                  unsigned int      index,
+                                                  const VectorType &vector) const
+{
+  Assert(data != nullptr, dealii::ExcNotInitialized());
   [[maybe_unused]] const unsigned int expected_components = 1;
-  Assert(dof_handler.get_fe().n_components() == expected_components,
+  Assert(data->get_dof_handler(index).get_fe().n_components() == expected_components,
          dealii::ExcMessage("The provided DoFHandler does not have the same number of "
                             "components as the expected ones. For scalar fields there "
                             "should be 1 component."));
 
-  // Update ghosts
-  vector.update_ghost_values();
-
-  // Set quadrature rule and FEValues to update the JxW values
-  const dealii::QGaussLobatto<dim> quadrature(degree + 1);
-  dealii::FEValues<dim>            fe_values(dof_handler.get_fe(),
-                                  quadrature,
-                                  dealii::update_values | dealii::update_JxW_values);
-
-  // Get the number of quadrature points
-  const unsigned int num_quad_points = quadrature.size();
-
-  // Create a value vector
-  std::vector<number> quad_values(num_quad_points);
-
-  // Loop over the cells provided by the DoFHandler
-  number value = 0.0;
-  for (const auto &cell : dof_handler.active_cell_iterators())
-    {
-      if (cell->is_locally_owned())
-        {
-          // Reinitialize the cell
-          fe_values.reinit(cell);
-
-          // Get the values
-          fe_values.get_function_values(vector, quad_values);
-
-          // Sum up the product of the JxW and values at each quadrature point to
-          // compute the element integral.
-          for (unsigned int q_point = 0; q_point < num_quad_points; ++q_point)
-            {
-              value += quad_values[q_point] * fe_values.JxW(q_point);
-            }
-        }
-    }
-
-  integral_value = dealii::Utilities::MPI::sum(value, MPI_COMM_WORLD);
+  std::map<unsigned int, std::vector<double>> integral_values;
+  compute_integrals(integral_values, {{index, const_cast<VectorType *>(&vector)}});
+  integral_value = integral_values.at(index)[0];
 }
 
 template <unsigned int dim, unsigned int degree, typename number>
 void
-Integrator<dim, degree, number>::compute_integral(
-  std::vector<number>           &integral_value,
-  const dealii::DoFHandler<dim> &dof_handler,
-  const VectorType              &vector) const
+Integrator<dim, degree, number>::compute_integral(std::vector<double> &integral_value,
+                                                  unsigned int         index,
+                                                  const VectorType    &vector) const
 {
+  Assert(data != nullptr, dealii::ExcNotInitialized());
   [[maybe_unused]] const unsigned int expected_components = dim;
-  Assert(dof_handler.get_fe().n_components() == expected_components,
+  Assert(data->get_dof_handler(index).get_fe().n_components() == expected_components,
          dealii::ExcMessage("The provided DoFHandler does not have the same number of "
                             "components as the expected ones. For vector fields there "
                             "should be dim components."));
   Assert(integral_value.size() == dim,
          dealii::ExcMessage("The provided `integral_value` must already be size dim"));
 
-  // Update ghosts
-  vector.update_ghost_values();
+  std::map<unsigned int, std::vector<double>> integral_values;
+  compute_integrals(integral_values, {{index, const_cast<VectorType *>(&vector)}});
+  integral_value = integral_values.at(index);
+}
 
-  // Set quadrature rule and FEValues to update the JxW values
-  const dealii::QGaussLobatto<dim> quadrature(degree + 1);
-  dealii::FEValues<dim>            fe_values(dof_handler.get_fe(),
-                                  quadrature,
-                                  dealii::update_values | dealii::update_JxW_values);
+template <unsigned int dim, unsigned int degree, typename number>
+void
+Integrator<dim, degree, number>::compute_integrals(
+  std::map<unsigned int, std::vector<double>> &integral_values,
+  const std::map<unsigned int, VectorType *>  &vectors) const
+{
+  Assert(data != nullptr, dealii::ExcNotInitialized());
 
-  // Get the number of quadrature points
-  const unsigned int num_quad_points = quadrature.size();
+  integral_values.clear();
+  if (vectors.empty())
+    {
+      return;
+    }
 
-  // Create a value vector
-  std::vector<dealii::Vector<number>> quad_values(num_quad_points,
-                                                  dealii::Vector<number>(dim));
+  // Lay out the integrals of each component of each field in the slots of a cell batch
+  std::map<unsigned int, unsigned int> n_components;
+  std::map<unsigned int, unsigned int> offsets;
+  unsigned int                         n_values_per_batch = 0;
+  std::vector<VectorType *>            src;
+  for (const auto &[index, vector] : vectors)
+    {
+      n_components[index] = data->get_dof_handler(index).get_fe().n_components();
+      Assert(n_components.at(index) == 1 || n_components.at(index) == dim,
+             dealii::ExcMessage("Only scalar and vector fields can be integrated."));
+      offsets[index] = n_values_per_batch;
+      n_values_per_batch += n_components.at(index);
+      src.push_back(vector);
+    }
 
-  // Loop over the cells and each lane in the vectorized array
-  std::vector<number> value(dim, 0.0);
-  for (const auto &cell : dof_handler.active_cell_iterators())
+  // Integrate all fields in one pass over the cells. The integrals of the cell batches
+  // are kept in double precision.
+  dealii::Vector<double> batch_values(data->n_cell_batches() * n_values_per_batch);
+
+  const auto local_integrate =
+    [&](const dealii::MatrixFree<dim, number, SizeType> &matrix_free,
+        dealii::Vector<double>                          &dst,
+        const std::vector<VectorType *>                 &fields,
+        const std::pair<unsigned int, unsigned int>     &cell_range)
+  {
+    unsigned int field = 0;
+    for (const auto &[index, offset] : offsets)
+      {
+        if (n_components.at(index) == 1)
+          {
+            integrate_cell_batches<1>(matrix_free,
+                                      index,
+                                      *fields[field],
+                                      offset,
+                                      n_values_per_batch,
+                                      dst,
+                                      cell_range);
+          }
+        else
+          {
+            integrate_cell_batches<dim>(matrix_free,
+                                        index,
+                                        *fields[field],
+                                        offset,
+                                        n_values_per_batch,
+                                        dst,
+                                        cell_range);
+          }
+        field++;
+      }
+  };
+
+  data->template cell_loop<dealii::Vector<double>, std::vector<VectorType *>>(
+    local_integrate,
+    batch_values,
+    src);
+
+  // Combine the cell batches of this process
+  std::vector<double> local_values(n_values_per_batch, 0.0);
+  for (unsigned int batch = 0; batch < data->n_cell_batches(); ++batch)
     {
-      if (cell->is_locally_owned())
+      for (unsigned int value = 0; value < n_values_per_batch; ++value)
         {
-          // Reinitialize the cell
-          fe_values.reinit(cell);
+          local_values[value] += batch_values[(batch * n_values_per_batch) + value];
+        }
+    }
+
+  // Reduce the integrals of all fields at once
+  std::vector<double> global_values(n_values_per_batch, 0.0);
+  dealii::Utilities::MPI::sum(local_values, MPI_COMM_WORLD, global_values);
+
+  for (const auto &[index, offset] : offsets)
+    {
+      integral_values[index].assign(global_values.begin() + offset,
+                                    global_values.begin() + offset +
+                                      n_components.at(index));
+    }
+}
 
-          // Get the values
-          fe_values.get_function_values(vector, quad_values);
+template <unsigned int dim, unsigned int degree, typename number>
+template <unsigned int n_components>
+void
+Integrator<dim, degree, number>::integrate_cell_batches(
+  const dealii::MatrixFree<dim, number, SizeType> &matrix_free,
+  unsigned int                                     index,
+  const VectorType                                &vector,
+  unsigned int                                     offset,
+  unsigned int                                     n_values_per_batch,
+  dealii::Vector<double>                          &batch_values,
+  const std::pair<unsigned int, unsigned int>     &cell_range) const
+{
+  dealii::FEEvaluation<dim, degree, degree + 1, n_components, number> fe_eval(
+    matrix_free,
+    index);
 
-          // Sum up the product of the JxW and values at each quadrature point to
-          // compute the element integral.
-          for (unsigned int q_point = 0; q_point < num_quad_points; ++q_point)
+  for (unsigned int batch = cell_range.first; batch < cell_range.second; ++batch)
+    {
+      fe_eval.reinit(batch);
+      fe_eval.read_dof_values_plain(vector);
+      fe_eval.evaluate(dealii::EvaluationFlags::values);
+
+      // Sum up the product of the JxW and values at each quadrature point of every lane
+      // at once
+      std::array<SizeType, n_components> integral;
+      integral.fill(SizeType(0.0));
+      for (const unsigned int q_point : fe_eval.quadrature_point_indices())
+        {
+          const auto value = fe_eval.get_value(q_point);
+          if constexpr (n_components == 1)
+            {
+              integral[0] += value * fe_eval.JxW(q_point);
+            }
+          else
             {
-              for (unsigned int dimension = 0; dimension < dim; dimension++)
+              for (unsigned int component = 0; component < n_components; ++component)
                 {
-                  value[dimension] +=
-                    quad_values[q_point][dimension] * fe_values.JxW(q_point);
+                  integral[component] += value[component] * fe_eval.JxW(q_point);
                 }
             }
         }
-    }
 
-  for (unsigned int dimension = 0; dimension < dim; dimension++)
-    {
-      value[dimension] = dealii::Utilities::MPI::sum(value[dimension], MPI_COMM_WORLD);
+      // Combine the lanes that hold cells
+      const unsigned int batch_offset = (batch * n_values_per_batch) + offset;
+      for (unsigned int lane = 0;
+           lane < matrix_free.n_active_entries_per_cell_batch(batch);
+           ++lane)
+        {
+          for (unsigned int component = 0; component < n_components; ++component)
+            {
+              batch_values[batch_offset + component] += integral[component][lane];
+            }
+        }
     }
-
-  integral_value = value;
 }
 
 #include "utilities/integrator.inst"
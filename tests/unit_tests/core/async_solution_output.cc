@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/utilities.h>
+
+#include <prismspf/core/async_solution_output.h>
+#include <prismspf/core/solution_output.h>
+#include <prismspf/core/type_enums.h>
+#include <prismspf/core/variable_attribute_loader.h>
+
+#include <prismspf/config.h>
+
+#include <fstream>
+#include <mpi.h>
+#include <sstream>
+#include <string>
+
+#include "catch.hpp"
+#include "test_problem.h"
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  // The unit square with 4 x 4 cells and a single output buffer
+  const std::string parameters = R"(
+set dim = 2
+set global refinement = 2
+set degree = 1
+
+subsection Rectangular mesh
+  set x size = 1.0
+  set y size = 1.0
+  set x subdivisions = 1
+  set y subdivisions = 1
+end
+
+set time step = 1.0
+set number steps = 1
+
+subsection output
+  set condition = EQUAL_SPACING
+  set number = 1
+  set file type = pvtu
+  set asynchronous = true
+  set buffers = 1
+end
+
+set boundary condition for n = Natural
+)";
+
+  class testVariableAttributeLoader : public VariableAttributeLoader
+  {
+  public:
+    ~testVariableAttributeLoader() override = default;
+
+    void
+    load_variable_attributes() override
+    {
+      set_variable_name(0, "n");
+      set_variable_type(0, Scalar);
+      set_variable_equation_type(0, ExplicitTimeDependent);
+      set_dependencies_value_term_rhs(0, "n");
+      set_dependencies_gradient_term_rhs(0, "");
+    }
+  };
+
+  // The initial condition n = 1 + x
+  template <unsigned int dim, unsigned int degree, typename number>
+  class testPDE : public TestPDE<dim, degree, number>
+  {
+  public:
+    using TestPDE<dim, degree, number>::TestPDE;
+
+    void
+    set_initial_condition([[maybe_unused]] const unsigned int       &index,
+                          [[maybe_unused]] const unsigned int       &component,
+                          const dealii::Point<dim>                  &point,
+                          number                                    &scalar_value,
+                          [[maybe_unused]] number &vector_component_value) const override
+    {
+      scalar_value = 1.0 + point[0];
+    }
+  };
+
+  // The name of the piece of this process for an output with 1 increment
+  std::string
+  piece_name(const std::string &name)
+  {
+    return name + "_0." +
+           dealii::Utilities::int_to_string(
+             dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD),
+             4) +
+           ".vtu";
+  }
+
+  // The content of a file without the line with the date and time it was written
+  std::string
+  read_file(const std::string &filename)
+  {
+    std::ifstream file(filename);
+    REQUIRE(file.is_open());
+    std::ostringstream content;
+    std::string        line;
+    while (std::getline(file, line))
+      {
+        if (line.find("generated by the deal.II library") == std::string::npos)
+          {
+            content << line << "\n";
+          }
+      }
+    return content.str();
+  }
+} // namespace
+
+/**
+ * @brief Test that the asynchronous output writes the same files as the synchronous
+ * output, that it blocks when every buffer is waiting to be written, and that the
+ * errors of the worker thread are rethrown.
+ */
+TEST_CASE("Asynchronous solution output")
+{
+  testVariableAttributeLoader attribute_loader;
+  TestProblem<2, 1, testPDE>  problem(attribute_loader,
+                                     parameters,
+                                     "async_solution_output.prm");
+
+  const auto &solution_set = problem.solution_handler.get_solution_vector();
+  const auto &dof_handlers = problem.dof_handler.get_dof_handlers();
+
+  SECTION("Same files as synchronous output")
+  {
+    SolutionOutput<2, double>(solution_set,
+                              dof_handlers,
+                              1,
+                              "sync_output",
+                              problem.user_inputs);
+    {
+      AsyncSolutionOutput<2, double> output(problem.user_inputs);
+      output.enqueue(solution_set, dof_handlers, 1, "async_output");
+
+      // The solution is copied when it is queued, so it can change while it is written
+      *solution_set.at(0) *= 2.0;
+      output.wait();
+    }
+
+    REQUIRE(read_file(piece_name("async_output")) ==
+            read_file(piece_name("sync_output")));
+
+    // The record only differs in the names of the pieces
+    if (dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+      {
+        std::string record   = read_file("sync_output_0.pvtu");
+        auto        position = record.find("\"sync_output");
+        while (position != std::string::npos)
+          {
+            record.replace(position + 1, 4, "async");
+            position = record.find("\"sync_output", position);
+          }
+        REQUIRE(read_file("async_output_0.pvtu") == record);
+      }
+  }
+
+  SECTION("Full buffer pool")
+  {
+    AsyncSolutionOutput<2, double> output(problem.user_inputs);
+    output.enqueue(solution_set, dof_handlers, 1, "first_output");
+
+    // With one buffer, the second output waits until the first is written
+    output.enqueue(solution_set, dof_handlers, 1, "second_output");
+    const std::string first_piece = read_file(piece_name("first_output"));
+    REQUIRE(first_piece.find("</VTKFile>") != std::string::npos);
+
+    output.wait();
+    REQUIRE(read_file(piece_name("second_output")) == first_piece);
+  }
+
+  SECTION("Worker exceptions")
+  {
+    AsyncSolutionOutput<2, double> output(problem.user_inputs);
+
+    // The directory does not exist, so the worker fails to open the piece
+    output.enqueue(solution_set, dof_handlers, 1, "missing_directory/async_output");
+    REQUIRE_THROWS(output.wait());
+
+    // The exception is only rethrown once and the worker keeps writing
+    REQUIRE_NOTHROW(output.wait());
+    output.enqueue(solution_set, dof_handlers, 1, "recovered_output");
+    REQUIRE_NOTHROW(output.wait());
+    REQUIRE(read_file(piece_name("recovered_output")).find("</VTKFile>") !=
+            std::string::npos);
+  }
+}
+
+PRISMS_PF_END_NAMESPACE
@@ -0,0 +1,283 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/data_out_base.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/point.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <prismspf/core/checkpoint_handler.h>
+#include <prismspf/core/solution_output.h>
+#include <prismspf/core/triangulation_handler.h>
+#include <prismspf/core/type_enums.h>
+#include <prismspf/core/variable_attribute_loader.h>
+
+#include <prismspf/config.h>
+
+#include <array>
+#include <mpi.h>
+#include <string>
+
+#include "catch.hpp"
+#include "test_problem.h"
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+  const std::string parameters = R"(
+set dim = 2
+set global refinement = 2
+set degree = 1
+
+subsection Rectangular mesh
+  set x size = 1.0
+  set y size = 1.0
+  set x subdivisions = 1
+  set y subdivisions = 1
+end
+
+set time step = 0.05
+set number steps = 20
+
+subsection output
+  set condition = EQUAL_SPACING
+  set number = 1
+end
+
+set boundary condition for n = Natural
+)";
+
+  // The time state that is saved
+  constexpr unsigned int increment = 7;
+  constexpr double       time      = 0.35;
+  constexpr double       dt        = 0.05;
+
+  // The triangulation of the checkpoint of the saved increment
+  const std::string triangulation_filename =
+    "checkpoint_" + std::to_string(increment) + "/triangulation";
+
+  // A field with two old solutions
+  class testVariableAttributeLoader : public VariableAttributeLoader
+  {
+  public:
+    ~testVariableAttributeLoader() override = default;
+
+    void
+    load_variable_attributes() override
+    {
+      set_variable_name(0, "n");
+      set_variable_type(0, Scalar);
+      set_variable_equation_type(0, ExplicitTimeDependent);
+
+      set_dependencies_value_term_rhs(0, "n, old_1(n), old_2(n)");
+      set_dependencies_gradient_term_rhs(0, "");
+    }
+  };
+
+  // The linear initial condition n = 1 + x + 2y, which is interpolated exactly on any
+  // mesh
+  double
+  initial_condition(const dealii::Point<2> &point)
+  {
+    return 1.0 + point[0] + (2.0 * point[1]);
+  }
+
+  template <unsigned int dim, unsigned int degree, typename number>
+  class testPDE : public TestPDE<dim, degree, number>
+  {
+  public:
+    using TestPDE<dim, degree, number>::TestPDE;
+
+    void
+    set_initial_condition([[maybe_unused]] const unsigned int       &index,
+                          [[maybe_unused]] const unsigned int       &component,
+                          const dealii::Point<dim>                  &point,
+                          number                                    &scalar_value,
+                          [[maybe_unused]] number &vector_component_value) const override
+    {
+      scalar_value = initial_condition(point);
+    }
+  };
+
+  // The saved solutions are multiples of the initial condition, so they differ from the
+  // initial conditions of a problem that is only set up for the restart
+  const std::array<DependencyType, 3> dependency_types = {
+    {DependencyType::Normal, DependencyType::OldOne, DependencyType::OldTwo}
+  };
+  const std::array<double, 3> scales = {
+    {-1.0, 2.0, 3.0}
+  };
+
+  // Refine the cells of the left half of the domain, so the mesh has hanging nodes
+  void
+  refine_left_half(TriangulationHandler<2> &triangulation_handler)
+  {
+    for (const auto &cell :
+         triangulation_handler.get_triangulation().active_cell_iterators())
+      {
+        if (cell->is_locally_owned() && cell->center()[0] < 0.5)
+          {
+            cell->set_refine_flag();
+          }
+      }
+    triangulation_handler.prepare_for_grid_refinement();
+    triangulation_handler.execute_grid_refinement();
+  }
+
+  // An XDMF record with one step
+  XDMFRecord
+  make_xdmf_record()
+  {
+    XDMFRecord xdmf_record;
+    xdmf_record.entries.emplace_back("solution_mesh_0.h5",
+                                     "solution_0.h5",
+                                     0.0,
+                                     25,
+                                     16,
+                                     2);
+    xdmf_record.mesh_filename = "solution_mesh_0.h5";
+    xdmf_record.mesh_changed  = false;
+    return xdmf_record;
+  }
+
+  // The largest difference between two vectors on any process
+  double
+  max_difference(const VectorType &vector, const VectorType &reference)
+  {
+    VectorType difference(reference);
+    difference -= vector;
+    return difference.linfty_norm();
+  }
+
+  // Load the checkpoint into a problem that is set up for the restart and check it
+  // against the saved mesh, solutions, time state, and XDMF record
+  template <typename Problem>
+  void
+  load_and_check(Problem &problem)
+  {
+    REQUIRE(problem.triangulation_handler.get_triangulation().n_global_active_cells() ==
+            40);
+    REQUIRE(problem.user_inputs.get_temporal_discretization().get_increment() == 0);
+
+    XDMFRecord                   xdmf_record;
+    CheckpointHandler<2, double> checkpoint_handler(problem.user_inputs,
+                                                   problem.triangulation_handler,
+                                                   problem.solution_handler,
+                                                   problem.matrix_free_container,
+                                                   xdmf_record);
+    checkpoint_handler.load();
+    problem.solution_handler.update_ghosts();
+
+    const auto &temporal_discretization =
+      problem.user_inputs.get_temporal_discretization();
+    REQUIRE(temporal_discretization.get_increment() == increment);
+    REQUIRE(temporal_discretization.get_time() == time);
+    REQUIRE(temporal_discretization.get_timestep() == dt);
+
+    for (unsigned int i = 0; i < dependency_types.size(); i++)
+      {
+        VectorType expected;
+        problem.matrix_free_container.get_matrix_free()->initialize_dof_vector(expected,
+                                                                               0);
+        dealii::VectorTools::interpolate(
+          problem.mapping,
+          problem.dof_handler.get_dof_handler(0),
+          dealii::ScalarFunctionFromFunctionObject<2>(
+            [i](const dealii::Point<2> &point)
+            {
+              return scales[i] * initial_condition(point);
+            }),
+          expected);
+
+        const auto *solution =
+          problem.solution_handler.get_solution_vector(0, dependency_types[i]);
+        REQUIRE(max_difference(*solution, expected) == Approx(0.0).margin(1.0e-12));
+      }
+
+    // The mesh is written again after a restart
+    const XDMFRecord saved_record = make_xdmf_record();
+    REQUIRE(xdmf_record.entries.size() == 1);
+    REQUIRE(xdmf_record.entries[0].get_xdmf_content(0) ==
+            saved_record.entries[0].get_xdmf_content(0));
+    REQUIRE(xdmf_record.mesh_filename == saved_record.mesh_filename);
+    REQUIRE(xdmf_record.mesh_changed);
+  }
+} // namespace
+
+/**
+ * @brief Test that a checkpoint of an adapted mesh restores the solutions, including the
+ * old solutions, the time state, and the XDMF record. The checkpoint is left for the
+ * reload test, which loads it on a different number of processes.
+ */
+TEST_CASE("Checkpoint round trip", "[checkpoint]")
+{
+  std::array<VectorType, 3> references;
+  {
+    testVariableAttributeLoader attribute_loader;
+    TestProblem<2, 1, testPDE>  problem(attribute_loader,
+                                       parameters,
+                                       "checkpoint_handler.prm",
+                                       refine_left_half);
+    REQUIRE(problem.triangulation_handler.get_triangulation().n_global_active_cells() ==
+            40);
+
+    for (unsigned int i = 0; i < dependency_types.size(); i++)
+      {
+        auto *solution =
+          problem.solution_handler.get_solution_vector(0, dependency_types[i]);
+        *solution *= scales[i];
+        solution->update_ghost_values();
+        references[i] = *solution;
+      }
+    problem.user_inputs.get_temporal_discretization().restore(increment, time, dt);
+
+    XDMFRecord                   xdmf_record = make_xdmf_record();
+    CheckpointHandler<2, double> checkpoint_handler(problem.user_inputs,
+                                                   problem.triangulation_handler,
+                                                   problem.solution_handler,
+                                                   problem.matrix_free_container,
+                                                   xdmf_record);
+    checkpoint_handler.save();
+    checkpoint_handler.wait();
+  }
+
+  // The first process records the checkpoint as the latest once it is staged
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  testVariableAttributeLoader attribute_loader;
+  TestProblem<2, 1, testPDE>  problem(attribute_loader,
+                                     parameters,
+                                     "checkpoint_handler.prm",
+                                     {},
+                                     triangulation_filename);
+  load_and_check(problem);
+
+  // With the same processes, the partition and the vectors are the same
+  for (unsigned int i = 0; i < dependency_types.size(); i++)
+    {
+      const auto *solution =
+        problem.solution_handler.get_solution_vector(0, dependency_types[i]);
+      REQUIRE(max_difference(*solution, references[i]) == 0.0);
+    }
+}
+
+/**
+ * @brief Test that the checkpoint of the round trip test loads on a different number of
+ * processes. This is hidden, and run by its own test after the round trip test.
+ */
+TEST_CASE("Checkpoint reload", "[.checkpoint_reload]")
+{
+  testVariableAttributeLoader attribute_loader;
+  TestProblem<2, 1, testPDE>  problem(attribute_loader,
+                                     parameters,
+                                     "checkpoint_handler_reload.prm",
+                                     {},
+                                     triangulation_filename);
+  load_and_check(problem);
+}
+
+PRISMS_PF_END_NAMESPACE
@@ -0,0 +1,359 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/point.h>
+
+#include <prismspf/core/grid_refiner.h>
+#include <prismspf/core/grid_refiner_context.h>
+#include <prismspf/core/type_enums.h>
+#include <prismspf/core/variable_attribute_loader.h>
+
+#include <prismspf/config.h>
+
+#include <cmath>
+#include <functional>
+#include <mpi.h>
+#include <string>
+#include <utility>
+
+#include "catch.hpp"
+#include "test_problem.h"
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  // The unit square with 8 x 8 cells at level 3, which can be refined once
+  const std::string parameters = R"(
+set dim = 2
+set global refinement = 3
+set degree = 1
+
+subsection Rectangular mesh
+  set x size = 1.0
+  set y size = 1.0
+  set x subdivisions = 1
+  set y subdivisions = 1
+end
+
+set mesh adaptivity = true
+set min refinement = 3
+set max refinement = 4
+set coarsen fraction = 0.0
+
+set time step = 1.0
+set number steps = 1
+
+subsection output
+  set condition = EQUAL_SPACING
+  set number = 1
+end
+
+set boundary condition for n = Natural
+)";
+
+  class testVariableAttributeLoader : public VariableAttributeLoader
+  {
+  public:
+    ~testVariableAttributeLoader() override = default;
+
+    void
+    load_variable_attributes() override
+    {
+      set_variable_name(0, "n");
+      set_variable_type(0, Scalar);
+      set_variable_equation_type(0, ExplicitTimeDependent);
+      set_dependencies_value_term_rhs(0, "n");
+      set_dependencies_gradient_term_rhs(0, "");
+    }
+  };
+
+  // The field n = |x - 0.5|, which is linear on every cell and has a kink along the
+  // cell faces at x = 0.5
+  template <unsigned int dim, unsigned int degree, typename number>
+  class testPDE : public TestPDE<dim, degree, number>
+  {
+  public:
+    using TestPDE<dim, degree, number>::TestPDE;
+
+    void
+    set_initial_condition([[maybe_unused]] const unsigned int       &index,
+                          [[maybe_unused]] const unsigned int       &component,
+                          const dealii::Point<dim>                  &point,
+                          number                                    &scalar_value,
+                          [[maybe_unused]] number &vector_component_value) const override
+    {
+      scalar_value = std::abs(point[0] - 0.5);
+    }
+  };
+
+  // The field n = x + y
+  template <unsigned int dim, unsigned int degree, typename number>
+  class rampPDE : public TestPDE<dim, degree, number>
+  {
+  public:
+    using TestPDE<dim, degree, number>::TestPDE;
+
+    void
+    set_initial_condition([[maybe_unused]] const unsigned int       &index,
+                          [[maybe_unused]] const unsigned int       &component,
+                          const dealii::Point<dim>                  &point,
+                          number                                    &scalar_value,
+                          [[maybe_unused]] number &vector_component_value) const override
+    {
+      scalar_value = point[0] + point[1];
+    }
+  };
+
+  // Do one adaptive refinement of the problem
+  template <template <unsigned int, unsigned int, typename> class Operator>
+  void
+  refine(TestProblem<2, 1, Operator> &problem)
+  {
+    GridRefinementContext<2, 1, double> grid_refinement_context(
+      problem.user_inputs,
+      problem.triangulation_handler,
+      problem.constraint_handler,
+      problem.matrix_free_container,
+      problem.invm_handler,
+      problem.solution_handler,
+      problem.dof_handler,
+      problem.fe_system,
+      problem.mapping,
+      problem.element_volume_container,
+      problem.mg_info,
+      problem.pde_operator);
+    GridRefiner<2, 1, double> grid_refiner(grid_refinement_context);
+    grid_refiner.init();
+    REQUIRE(grid_refiner.do_adaptive_refinement());
+  }
+
+  // The number of refined cells on all processes, and the number of them whose center
+  // satisfies the given condition
+  std::pair<unsigned int, unsigned int>
+  count_refined_cells(const TestProblem<2, 1, testPDE>                    &problem,
+                      const std::function<bool(const dealii::Point<2> &)> &in_region)
+  {
+    unsigned int n_refined   = 0;
+    unsigned int n_in_region = 0;
+    for (const auto &cell :
+         problem.triangulation_handler.get_triangulation().active_cell_iterators())
+      {
+        if (!cell->is_locally_owned() || cell->level() != 4)
+          {
+            continue;
+          }
+        n_refined++;
+        if (in_region(cell->center()))
+          {
+            n_in_region++;
+          }
+      }
+    return {dealii::Utilities::MPI::sum(n_refined, MPI_COMM_WORLD),
+            dealii::Utilities::MPI::sum(n_in_region, MPI_COMM_WORLD)};
+  }
+} // namespace
+
+/**
+ * @brief Test the cells that are refined by each marking strategy for a known field.
+ * Nothing is coarsened, since the cells start at the minimum refinement level.
+ */
+TEST_CASE("Grid refiner marking")
+{
+  testVariableAttributeLoader attribute_loader;
+
+  // The columns of cells next to x = 0.5
+  const auto next_to_kink = [](const dealii::Point<2> &center)
+  {
+    return std::abs(center[0] - 0.5) < 0.125;
+  };
+
+  SECTION("Threshold")
+  {
+    // The field exceeds 0.3 at a vertex of the two outer columns of cells on each side
+    const std::string threshold_parameters = parameters + R"(
+set refinement marking strategy = threshold
+subsection refinement criterion: n
+  set type = value
+  set value lower bound = 0.3
+  set value upper bound = 1.0
+end
+)";
+    TestProblem<2, 1, testPDE> problem(attribute_loader,
+                                       threshold_parameters,
+                                       "grid_refiner_threshold.prm");
+    refine(problem);
+
+    const auto [n_refined, n_in_region] = count_refined_cells(
+      problem,
+      [](const dealii::Point<2> &center)
+      {
+        return std::abs(center[0] - 0.5) > 0.25;
+      });
+    REQUIRE(n_refined == 4 * 32);
+    REQUIRE(n_in_region == n_refined);
+    REQUIRE(problem.triangulation_handler.get_triangulation().n_global_active_cells() ==
+            32 + (4 * 32));
+  }
+
+  SECTION("Kelly with fixed fraction")
+  {
+    // The normal gradient only jumps across the faces at x = 0.5, so the 16 cells next to
+    // them have the same indicator and all others have none
+    const std::string kelly_parameters = parameters + R"(
+set refinement marking strategy = fixed_fraction
+set refine fraction = 0.3
+subsection refinement criterion: n
+  set type = kelly
+end
+)";
+    TestProblem<2, 1, testPDE> problem(attribute_loader,
+                                       kelly_parameters,
+                                       "grid_refiner_kelly.prm");
+    refine(problem);
+
+    const auto [n_refined, n_in_region] = count_refined_cells(problem, next_to_kink);
+    REQUIRE(n_refined == 4 * 16);
+    REQUIRE(n_in_region == n_refined);
+  }
+
+  SECTION("Curvature with fixed number")
+  {
+    // The approximate second derivative is only nonzero on the 16 cells next to the
+    // kink, which are a quarter of the cells
+    const std::string curvature_parameters = parameters + R"(
+set refinement marking strategy = fixed_number
+set refine fraction = 0.25
+subsection refinement criterion: n
+  set type = curvature
+end
+)";
+    TestProblem<2, 1, testPDE> problem(attribute_loader,
+                                       curvature_parameters,
+                                       "grid_refiner_curvature.prm");
+    refine(problem);
+
+    const auto [n_refined, n_in_region] = count_refined_cells(problem, next_to_kink);
+    REQUIRE(n_refined == 4 * 16);
+    REQUIRE(n_in_region == n_refined);
+  }
+}
+
+/**
+ * @brief Test that the remeshing event is triggered when the feature tracked by the
+ * criteria reaches the cells next to the refined region, and that the remeshing moves the
+ * refined region with it.
+ */
+TEST_CASE("Grid refiner remeshing event")
+{
+  // The zero level set of the field is refined, which is initially at x = 0.5
+  const std::string event_parameters = parameters + R"(
+set remeshing trigger = event
+set refinement marking strategy = threshold
+subsection refinement criterion: n
+  set type = value
+  set value lower bound = -0.01
+  set value upper bound = 0.01
+end
+)";
+  testVariableAttributeLoader attribute_loader;
+  TestProblem<2, 1, testPDE>  problem(attribute_loader,
+                                     event_parameters,
+                                     "grid_refiner_event.prm");
+
+  GridRefinementContext<2, 1, double> grid_refinement_context(
+    problem.user_inputs,
+    problem.triangulation_handler,
+    problem.constraint_handler,
+    problem.matrix_free_container,
+    problem.invm_handler,
+    problem.solution_handler,
+    problem.dof_handler,
+    problem.fe_system,
+    problem.mapping,
+    problem.element_volume_container,
+    problem.mg_info,
+    problem.pde_operator);
+  GridRefiner<2, 1, double> grid_refiner(grid_refinement_context);
+  grid_refiner.init();
+
+  // Move the zero level set to |x - 0.5| = shift
+  double     current_shift = 0.0;
+  const auto move_level_set = [&](double shift)
+  {
+    problem.solution_handler.get_solution_vector(0, DependencyType::Normal)
+      ->add(current_shift - shift);
+    problem.solution_handler.update_ghosts();
+    current_shift = shift;
+  };
+
+  // There is no refined region to leave yet
+  REQUIRE_FALSE(grid_refiner.criteria_met_outside_refined_region());
+
+  // The two columns of cells next to x = 0.5 are refined
+  REQUIRE(grid_refiner.do_adaptive_refinement());
+  REQUIRE(count_refined_cells(problem,
+                              [](const dealii::Point<2> &center)
+                              {
+                                return std::abs(center[0] - 0.5) < 0.125;
+                              })
+            .second == 4 * 16);
+  REQUIRE_FALSE(grid_refiner.criteria_met_outside_refined_region());
+
+  // Features that appear away from the refined region are not checked
+  move_level_set(0.375);
+  REQUIRE_FALSE(grid_refiner.criteria_met_outside_refined_region());
+
+  // The level set reaches the columns of cells next to the refined region
+  move_level_set(0.25);
+  REQUIRE(grid_refiner.criteria_met_outside_refined_region());
+
+  // The remeshing refines the new columns around the level set and coarsens the old ones
+  REQUIRE(grid_refiner.do_adaptive_refinement());
+  const auto [n_refined, n_in_region] = count_refined_cells(
+    problem,
+    [](const dealii::Point<2> &center)
+    {
+      return std::abs(std::abs(center[0] - 0.5) - 0.25) < 0.125;
+    });
+  REQUIRE(n_refined == 4 * 32);
+  REQUIRE(n_in_region == n_refined);
+  REQUIRE_FALSE(grid_refiner.criteria_met_outside_refined_region());
+}
+
+/**
+ * @brief Test that a grid with measured cell weights is partitioned by cell count after
+ * the initial refinement, before the cost of any cell has been measured. The refined
+ * corner would otherwise stay on the processes that owned it. This is only meaningful on
+ * more than one process.
+ */
+TEST_CASE("Grid refiner repartitioning", "[repartition]")
+{
+  // The cells with a vertex where x + y < 0.5 are refined, which is a corner of 10 cells
+  const std::string repartition_parameters = parameters + R"(
+set cell weighting = measured
+set repartition imbalance threshold = 1.1
+set refinement marking strategy = threshold
+subsection refinement criterion: n
+  set type = value
+  set value lower bound = -1.0
+  set value upper bound = 0.5
+end
+)";
+  testVariableAttributeLoader attribute_loader;
+  TestProblem<2, 1, rampPDE>  problem(attribute_loader,
+                                     repartition_parameters,
+                                     "grid_refiner_repartition.prm");
+  refine(problem);
+
+  const auto &triangulation = problem.triangulation_handler.get_triangulation();
+  REQUIRE(triangulation.n_global_active_cells() == 54 + (4 * 10));
+
+  const auto cells = dealii::Utilities::MPI::min_max_avg(
+    static_cast<double>(triangulation.n_locally_owned_active_cells()),
+    MPI_COMM_WORLD);
+  REQUIRE(cells.max / cells.avg <= 1.1);
+}
+
+PRISMS_PF_END_NAMESPACE
@@ -0,0 +1,277 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/utilities.h>
+
+#include <prismspf/core/isosurface_output.h>
+#include <prismspf/core/variable_attribute_loader.h>
+
+#include <prismspf/config.h>
+
+#include <fstream>
+#include <map>
+#include <mpi.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+#include "test_problem.h"
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  // The unit square with 8 x 8 cells
+  const std::string parameters_2d = R"(
+set dim = 2
+set global refinement = 3
+set degree = 1
+
+subsection Rectangular mesh
+  set x size = 1.0
+  set y size = 1.0
+  set x subdivisions = 1
+  set y subdivisions = 1
+end
+
+set time step = 1.0
+set number steps = 1
+
+subsection output
+  set condition = EQUAL_SPACING
+  set number = 1
+  set isosurface fields = u
+  set isosurface values = 0.3, 0.7
+end
+
+set boundary condition for u = Natural
+)";
+
+  // The unit interval with 8 cells
+  const std::string parameters_1d = R"(
+set dim = 1
+set global refinement = 3
+set degree = 1
+
+subsection Rectangular mesh
+  set x size = 1.0
+  set x subdivisions = 1
+end
+
+set time step = 1.0
+set number steps = 1
+
+subsection output
+  set condition = EQUAL_SPACING
+  set number = 1
+  set isosurface fields = u
+  set isosurface values = 0.3, 0.7
+end
+
+set boundary condition for u = Natural
+)";
+
+  class testVariableAttributeLoader : public VariableAttributeLoader
+  {
+  public:
+    ~testVariableAttributeLoader() override = default;
+
+    void
+    load_variable_attributes() override
+    {
+      set_variable_name(0, "u");
+      set_variable_type(0, Scalar);
+      set_variable_equation_type(0, ExplicitTimeDependent);
+      set_dependencies_value_term_rhs(0, "u");
+      set_dependencies_gradient_term_rhs(0, "");
+    }
+  };
+
+  // The field u = x, whose isosurfaces are the planes x = isovalue
+  template <unsigned int dim, unsigned int degree, typename number>
+  class testPDE : public TestPDE<dim, degree, number>
+  {
+  public:
+    using TestPDE<dim, degree, number>::TestPDE;
+
+    void
+    set_initial_condition([[maybe_unused]] const unsigned int       &index,
+                          [[maybe_unused]] const unsigned int       &component,
+                          const dealii::Point<dim>                  &point,
+                          number                                    &scalar_value,
+                          [[maybe_unused]] number &vector_component_value) const override
+    {
+      scalar_value = point[0];
+    }
+  };
+
+  // Write the isosurfaces of u and return the name of the piece of this process
+  template <unsigned int dim>
+  std::string
+  write_isosurfaces(const std::string &parameters, const std::string &name)
+  {
+    testVariableAttributeLoader attribute_loader;
+    TestProblem<dim, 1, testPDE> problem(attribute_loader, parameters, name + ".prm");
+
+    const IsosurfaceOutput<dim, double> isosurface_output(
+      problem.solution_handler.get_solution_vector(),
+      problem.dof_handler.get_dof_handlers(),
+      problem.mapping,
+      1,
+      name,
+      problem.user_inputs);
+
+    return name + "_u_0." +
+           dealii::Utilities::int_to_string(
+             dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD),
+             4) +
+           ".vtp";
+  }
+
+  std::string
+  read_file(const std::string &filename)
+  {
+    std::ifstream     file(filename);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+  }
+
+  // The value of a count attribute of the piece, like NumberOfPoints
+  unsigned int
+  get_count(const std::string &piece, const std::string &attribute)
+  {
+    const auto position = piece.find(attribute + "=\"");
+    REQUIRE(position != std::string::npos);
+    return std::stoul(piece.substr(position + attribute.size() + 2));
+  }
+
+  // The values of the data array whose opening tag ends with the given attributes
+  std::vector<double>
+  get_data_array(const std::string &piece, const std::string &attributes)
+  {
+    const std::string tag      = attributes + " format=\"ascii\">";
+    const auto        position = piece.find(tag);
+    REQUIRE(position != std::string::npos);
+    const auto start = position + tag.size();
+    const auto end   = piece.find("</DataArray>", start);
+    REQUIRE(end != std::string::npos);
+
+    std::istringstream  stream(piece.substr(start, end - start));
+    std::vector<double> values;
+    double              value = 0.0;
+    while (stream >> value)
+      {
+        values.push_back(value);
+      }
+    return values;
+  }
+
+  unsigned int
+  sum_over_processes(unsigned int value)
+  {
+    return dealii::Utilities::MPI::sum(value, MPI_COMM_WORLD);
+  }
+} // namespace
+
+/**
+ * @brief Test the isosurfaces of a known field. Two contours are written to the same
+ * piece, so the cells of the second must refer to its own vertices.
+ */
+TEST_CASE("Isosurface output")
+{
+  const unsigned int n_mpi_processes =
+    dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  SECTION("Isolines in 2D")
+  {
+    const std::string piece =
+      read_file(write_isosurfaces<2>(parameters_2d, "isosurface_2d"));
+
+    const unsigned int n_points = get_count(piece, "NumberOfPoints");
+    const unsigned int n_lines  = get_count(piece, "NumberOfLines");
+    REQUIRE(get_count(piece, "NumberOfVerts") == 0);
+    REQUIRE(get_count(piece, "NumberOfPolys") == 0);
+
+    // Each contour crosses the 8 rows of cells once
+    REQUIRE(sum_over_processes(n_lines) == 16);
+
+    const auto isovalues    = get_data_array(piece, "Name=\"isovalue\"");
+    const auto points       = get_data_array(piece, "NumberOfComponents=\"3\"");
+    const auto connectivity = get_data_array(piece, "Name=\"connectivity\"");
+    const auto offsets      = get_data_array(piece, "Name=\"offsets\"");
+    REQUIRE(isovalues.size() == n_points);
+    REQUIRE(points.size() == 3 * n_points);
+    REQUIRE(connectivity.size() == 2 * n_lines);
+    REQUIRE(offsets.size() == n_lines);
+
+    // Every line joins two vertices of the same contour, which lie on x = isovalue
+    std::map<double, unsigned int> n_contour_lines;
+    for (unsigned int line = 0; line < n_lines; ++line)
+      {
+        REQUIRE(offsets[line] == 2 * (line + 1));
+
+        const auto first  = static_cast<unsigned int>(connectivity[2 * line]);
+        const auto second = static_cast<unsigned int>(connectivity[(2 * line) + 1]);
+        REQUIRE(first < n_points);
+        REQUIRE(second < n_points);
+        REQUIRE(isovalues[first] == isovalues[second]);
+        REQUIRE(points[3 * first] == Approx(isovalues[first]));
+        REQUIRE(points[3 * second] == Approx(isovalues[second]));
+        REQUIRE(points[(3 * first) + 2] == 0.0);
+
+        n_contour_lines[isovalues[first]]++;
+      }
+    REQUIRE(sum_over_processes(n_contour_lines[0.3]) == 8);
+    REQUIRE(sum_over_processes(n_contour_lines[0.7]) == 8);
+
+    // The record lists the piece of every process
+    if (dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+      {
+        const std::string record = read_file("isosurface_2d_u_0.pvtp");
+        REQUIRE(record.find("<Piece Source=\"isosurface_2d_u_0.0000.vtp\"/>") !=
+                std::string::npos);
+        unsigned int n_pieces = 0;
+        for (auto position = record.find("<Piece ");
+             position != std::string::npos;
+             position = record.find("<Piece ", position + 1))
+          {
+            n_pieces++;
+          }
+        REQUIRE(n_pieces == n_mpi_processes);
+      }
+  }
+
+  SECTION("Points in 1D")
+  {
+    const std::string piece =
+      read_file(write_isosurfaces<1>(parameters_1d, "isosurface_1d"));
+
+    // Each point is written as its own vertex cell
+    const unsigned int n_points = get_count(piece, "NumberOfPoints");
+    REQUIRE(get_count(piece, "NumberOfVerts") == n_points);
+    REQUIRE(get_count(piece, "NumberOfLines") == 0);
+    REQUIRE(sum_over_processes(n_points) == 2);
+
+    const auto isovalues    = get_data_array(piece, "Name=\"isovalue\"");
+    const auto points       = get_data_array(piece, "NumberOfComponents=\"3\"");
+    const auto connectivity = get_data_array(piece, "Name=\"connectivity\"");
+    const auto offsets      = get_data_array(piece, "Name=\"offsets\"");
+    REQUIRE(isovalues.size() == n_points);
+    REQUIRE(points.size() == 3 * n_points);
+    REQUIRE(connectivity.size() == n_points);
+    REQUIRE(offsets.size() == n_points);
+    for (unsigned int point = 0; point < n_points; ++point)
+      {
+        REQUIRE(connectivity[point] == point);
+        REQUIRE(offsets[point] == point + 1);
+        REQUIRE(points[3 * point] == Approx(isovalues[point]));
+        REQUIRE(points[(3 * point) + 1] == 0.0);
+      }
+  }
+}
+
+PRISMS_PF_END_NAMESPACE
@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/point.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <prismspf/core/type_enums.h>
+#include <prismspf/core/variable_attribute_loader.h>
+
+#include <prismspf/user_inputs/user_input_parameters.h>
+
+#include <prismspf/config.h>
+
+#include <array>
+#include <limits>
+#include <string>
+
+#include "catch.hpp"
+#include "test_problem.h"
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+  const std::string parameters = R"(
+set dim = 2
+set global refinement = 2
+set degree = 1
+
+subsection Rectangular mesh
+  set x size = 1.0
+  set y size = 1.0
+  set x subdivisions = 1
+  set y subdivisions = 1
+end
+
+set time step = 1.0
+set number steps = 1
+
+subsection output
+  set condition = EQUAL_SPACING
+  set number = 1
+end
+
+set boundary condition for n = Natural
+)";
+
+  // A field with two old solutions
+  class testVariableAttributeLoader : public VariableAttributeLoader
+  {
+  public:
+    ~testVariableAttributeLoader() override = default;
+
+    void
+    load_variable_attributes() override
+    {
+      set_variable_name(0, "n");
+      set_variable_type(0, Scalar);
+      set_variable_equation_type(0, ExplicitTimeDependent);
+
+      set_dependencies_value_term_rhs(0, "n, old_1(n), old_2(n)");
+      set_dependencies_gradient_term_rhs(0, "");
+    }
+  };
+
+  // The initial condition n = 1 + x + 2y
+  template <unsigned int dim, unsigned int degree, typename number>
+  class testPDE : public TestPDE<dim, degree, number>
+  {
+  public:
+    using TestPDE<dim, degree, number>::TestPDE;
+
+    void
+    set_initial_condition([[maybe_unused]] const unsigned int       &index,
+                          [[maybe_unused]] const unsigned int       &component,
+                          const dealii::Point<dim>                  &point,
+                          number                                    &scalar_value,
+                          [[maybe_unused]] number &vector_component_value) const override
+    {
+      scalar_value = 1.0 + point[0] + (2.0 * point[1]);
+    }
+  };
+
+  // The dependency types of the field
+  const std::array<DependencyType, 3> dependency_types = {
+    {DependencyType::Normal, DependencyType::OldOne, DependencyType::OldTwo}
+  };
+
+  // The largest difference between two vectors on any process
+  double
+  max_difference(const VectorType &vector, const VectorType &reference)
+  {
+    VectorType difference(reference);
+    difference -= vector;
+    return difference.linfty_norm();
+  }
+} // namespace
+
+/**
+ * @brief Test the snapshots and the finite check of the solution handler, which are used
+ * to roll back and retry increments with non-finite solutions.
+ */
+TEST_CASE("Solution handler")
+{
+  testVariableAttributeLoader attribute_loader;
+  TestProblem<2, 1, testPDE>  problem(attribute_loader,
+                                     parameters,
+                                     "solution_handler.prm");
+
+  auto &solution_handler = problem.solution_handler;
+
+  SECTION("Snapshot restore")
+  {
+    // Give each vector its own values
+    *solution_handler.get_solution_vector(0, DependencyType::OldOne) *= 2.0;
+    *solution_handler.get_solution_vector(0, DependencyType::OldTwo) *= 3.0;
+    solution_handler.update_ghosts();
+
+    std::array<VectorType, 3> references;
+    for (unsigned int i = 0; i < dependency_types.size(); i++)
+      {
+        references[i] = *solution_handler.get_solution_vector(0, dependency_types[i]);
+      }
+    solution_handler.save_snapshot();
+
+    // Change every vector like an increment does, including the rotation of the old
+    // solutions through the spare history vector
+    const VectorType update(references[0]);
+    solution_handler.prepare_history(0);
+    solution_handler.add_to_solution(0, 1.0, update);
+    solution_handler.rotate_history(0);
+    for (unsigned int i = 0; i < dependency_types.size(); i++)
+      {
+        const auto *solution =
+          solution_handler.get_solution_vector(0, dependency_types[i]);
+        REQUIRE(max_difference(*solution, references[i]) > 0.0);
+      }
+
+    // All vectors are restored exactly, and the snapshot can be restored again
+    for (unsigned int restore = 0; restore < 2; restore++)
+      {
+        solution_handler.restore_snapshot();
+        for (unsigned int i = 0; i < dependency_types.size(); i++)
+          {
+            const auto *solution =
+              solution_handler.get_solution_vector(0, dependency_types[i]);
+            REQUIRE(max_difference(*solution, references[i]) == 0.0);
+          }
+        solution_handler.add_to_solution(0, 1.0, update);
+      }
+  }
+
+  SECTION("Non-finite detection")
+  {
+    const VectorType update(
+      *solution_handler.get_solution_vector(0, DependencyType::Normal));
+
+    // Nothing has been updated yet
+    solution_handler.reset_finite_check();
+    REQUIRE(solution_handler.solution_is_finite());
+
+    solution_handler.save_snapshot();
+    solution_handler.add_to_solution(0, 1.0, update);
+    REQUIRE(solution_handler.solution_is_finite());
+
+    // An infinite step makes every entry non-finite
+    solution_handler.add_to_solution(0, std::numeric_limits<double>::infinity(), update);
+    REQUIRE_FALSE(solution_handler.solution_is_finite());
+
+    // Only the latest update of a solution counts, so a finite step from the snapshot
+    // replaces the failed one, like the trial steps of a line search
+    solution_handler.restore_snapshot();
+    solution_handler.add_to_solution(0, 1.0, update);
+    REQUIRE(solution_handler.solution_is_finite());
+
+    // The scaling of the new solutions is checked as well
+    VectorType scaling(update);
+    for (auto &value : scaling)
+      {
+        value = std::numeric_limits<double>::quiet_NaN();
+      }
+    *solution_handler.get_new_solution_vector(0) = update;
+    solution_handler.scale_new_solution(0, scaling);
+    REQUIRE_FALSE(solution_handler.solution_is_finite());
+
+    // Resetting the check forgets all updates
+    solution_handler.reset_finite_check();
+    REQUIRE(solution_handler.solution_is_finite());
+
+    *solution_handler.get_new_solution_vector(0) = update;
+    solution_handler.scale_new_solution(0, update);
+    REQUIRE(solution_handler.solution_is_finite());
+  }
+}
+
+PRISMS_PF_END_NAMESPACE
@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/numerics/data_out.h>
+
+#include <prismspf/core/solution_output.h>
+#include <prismspf/core/type_enums.h>
+#include <prismspf/core/variable_attribute_loader.h>
+
+#include <prismspf/config.h>
+
+#include <mpi.h>
+#include <sstream>
+#include <string>
+
+#include "catch.hpp"
+#include "test_problem.h"
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  // The unit square with 8 x 8 cells, with the output options appended
+  const std::string parameters = R"(
+set dim = 2
+set global refinement = 3
+set degree = 1
+
+subsection Rectangular mesh
+  set x size = 1.0
+  set y size = 1.0
+  set x subdivisions = 1
+  set y subdivisions = 1
+end
+
+set time step = 1.0
+set number steps = 1
+
+set boundary condition for n = Natural
+set boundary condition for m = Natural
+
+subsection output
+  set condition = EQUAL_SPACING
+  set number = 1
+)";
+
+  // A field that is written, a field that is masked, and a postprocessed field
+  class testVariableAttributeLoader : public VariableAttributeLoader
+  {
+  public:
+    ~testVariableAttributeLoader() override = default;
+
+    void
+    load_variable_attributes() override
+    {
+      set_variable_name(0, "n");
+      set_variable_type(0, Scalar);
+      set_variable_equation_type(0, ExplicitTimeDependent);
+      set_dependencies_value_term_rhs(0, "n");
+      set_dependencies_gradient_term_rhs(0, "");
+
+      set_variable_name(1, "m");
+      set_variable_type(1, Scalar);
+      set_variable_equation_type(1, ExplicitTimeDependent);
+      set_is_output_field(1, false);
+      set_dependencies_value_term_rhs(1, "m");
+      set_dependencies_gradient_term_rhs(1, "");
+
+      set_variable_name(2, "f");
+      set_variable_type(2, Scalar);
+      set_variable_equation_type(2, ExplicitTimeDependent);
+      set_is_postprocessed_field(2, true);
+      set_dependencies_value_term_rhs(2, "n");
+      set_dependencies_gradient_term_rhs(2, "");
+    }
+  };
+
+  // Add the fields to a DataOut object and return the vtu piece of this process
+  std::string
+  write_output(const std::string &output_options, const std::string &name)
+  {
+    testVariableAttributeLoader attribute_loader;
+    TestProblem<2, 1, TestPDE>  problem(attribute_loader,
+                                       parameters + output_options + "end\n",
+                                       name + ".prm");
+
+    dealii::DataOut<2> data_out;
+    SolutionOutput<2, double>::add_data_vectors(
+      data_out,
+      problem.solution_handler.get_solution_vector(),
+      problem.dof_handler.get_dof_handlers(),
+      problem.user_inputs);
+    data_out.build_patches(1);
+
+    std::ostringstream piece;
+    data_out.write_vtu(piece);
+    return piece.str();
+  }
+
+  bool
+  has_field(const std::string &piece, const std::string &field)
+  {
+    return piece.find("Name=\"" + field + "\"") != std::string::npos;
+  }
+
+  // The number of cells written by all processes
+  unsigned int
+  get_n_cells(const std::string &piece)
+  {
+    const std::string attribute = "NumberOfCells=\"";
+    const auto        position  = piece.find(attribute);
+    REQUIRE(position != std::string::npos);
+    const auto n_cells =
+      static_cast<unsigned int>(std::stoul(piece.substr(position + attribute.size())));
+    return dealii::Utilities::MPI::sum(n_cells, MPI_COMM_WORLD);
+  }
+} // namespace
+
+/**
+ * @brief Test the selection of the fields and cells that are written to the output.
+ */
+TEST_CASE("Solution output")
+{
+  SECTION("Output fields")
+  {
+    // The masked field is never written
+    const std::string piece = write_output("", "solution_output_fields");
+    REQUIRE(has_field(piece, "n"));
+    REQUIRE_FALSE(has_field(piece, "m"));
+    REQUIRE(has_field(piece, "f"));
+    REQUIRE(get_n_cells(piece) == 64);
+
+    const std::string postprocessed_piece =
+      write_output("set postprocessed fields only = true\n",
+                   "solution_output_postprocessed_fields");
+    REQUIRE_FALSE(has_field(postprocessed_piece, "n"));
+    REQUIRE_FALSE(has_field(postprocessed_piece, "m"));
+    REQUIRE(has_field(postprocessed_piece, "f"));
+  }
+  SECTION("Output region")
+  {
+    // The region lies inside the first 4 x 2 cells
+    const std::string piece = write_output("set region lower corner = 0.01, 0.01\n"
+                                           "set region upper corner = 0.49, 0.24\n",
+                                           "solution_output_region");
+    REQUIRE(get_n_cells(piece) == 8);
+
+    // The cells that touch the region are written too
+    const std::string touching_piece =
+      write_output("set region lower corner = 0.0, 0.0\n"
+                   "set region upper corner = 0.5, 0.25\n",
+                   "solution_output_touching_region");
+    REQUIRE(get_n_cells(touching_piece) == 15);
+  }
+}
+
+PRISMS_PF_END_NAMESPACE
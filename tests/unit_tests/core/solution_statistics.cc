@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/point.h>
+
+#include <prismspf/core/solution_statistics.h>
+#include <prismspf/core/variable_attribute_loader.h>
+
+#include <prismspf/config.h>
+
+#include <cmath>
+#include <string>
+
+#include "catch.hpp"
+#include "test_problem.h"
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  // A 2 x 1 domain with 16 x 8 cells
+  const std::string parameters = R"(
+set dim = 2
+set global refinement = 3
+set degree = 1
+
+subsection Rectangular mesh
+  set x size = 2.0
+  set y size = 1.0
+  set x subdivisions = 2
+  set y subdivisions = 1
+end
+
+set time step = 1.0
+set number steps = 1
+
+subsection output
+  set condition = EQUAL_SPACING
+  set number = 1
+  set statistics = integral, l2 norm, min, max, mean, phase fraction, interface area
+end
+
+set boundary condition for ramp = Natural
+set boundary condition for step = Natural
+)";
+
+  class testVariableAttributeLoader : public VariableAttributeLoader
+  {
+  public:
+    ~testVariableAttributeLoader() override = default;
+
+    void
+    load_variable_attributes() override
+    {
+      set_variable_name(0, "ramp");
+      set_variable_type(0, Scalar);
+      set_variable_equation_type(0, ExplicitTimeDependent);
+      set_dependencies_value_term_rhs(0, "ramp");
+      set_dependencies_gradient_term_rhs(0, "");
+
+      set_variable_name(1, "step");
+      set_variable_type(1, Scalar);
+      set_variable_equation_type(1, ExplicitTimeDependent);
+      set_dependencies_value_term_rhs(1, "step");
+      set_dependencies_gradient_term_rhs(1, "");
+    }
+  };
+
+  // A linear ramp from 0 to 1 across the domain and a step from 0 to 1 at x = 1
+  template <unsigned int dim, unsigned int degree, typename number>
+  class testPDE : public TestPDE<dim, degree, number>
+  {
+  public:
+    using TestPDE<dim, degree, number>::TestPDE;
+
+    void
+    set_initial_condition(const unsigned int                        &index,
+                          [[maybe_unused]] const unsigned int       &component,
+                          const dealii::Point<dim>                  &point,
+                          number                                    &scalar_value,
+                          [[maybe_unused]] number &vector_component_value) const override
+    {
+      if (index == 0)
+        {
+          scalar_value = point[0] / 2.0;
+        }
+      else
+        {
+          scalar_value = point[0] > 1.0 ? 1.0 : 0.0;
+        }
+    }
+  };
+} // namespace
+
+/**
+ * @brief Test the solution statistics of fields with known values. The quadrature points
+ * are the support points, so the integrals are those of the interpolated fields.
+ */
+TEST_CASE("Solution statistics")
+{
+  testVariableAttributeLoader attribute_loader;
+  TestProblem<2, 1, testPDE>  problem(attribute_loader,
+                                     parameters,
+                                     "solution_statistics.prm");
+
+  SolutionStatistics<2, 1, double> solution_statistics(problem.user_inputs);
+  solution_statistics.compute(problem.matrix_free_container.get_matrix_free(),
+                              problem.solution_handler.get_solution_vector());
+  const auto &statistics = solution_statistics.get_statistics();
+  REQUIRE(statistics.size() == 2);
+
+  SECTION("Integral, l2-norm, and extrema")
+  {
+    const auto &ramp = statistics.at(0);
+    REQUIRE(ramp.integral.size() == 1);
+    REQUIRE(ramp.integral[0] == Approx(1.0));
+    REQUIRE(ramp.min == Approx(0.0).margin(1.0e-12));
+    REQUIRE(ramp.max == Approx(1.0));
+
+    // The ramp is i/16 on each of the 9 rows of 17 nodes
+    REQUIRE(ramp.l2_norm == Approx(std::sqrt(9.0 * 1496.0 / 256.0)));
+
+    // The interpolated step rises across the cell right of x = 1, which holds half of
+    // its value
+    const auto &step = statistics.at(1);
+    REQUIRE(step.integral[0] == Approx(0.9375));
+    REQUIRE(step.min == Approx(0.0).margin(1.0e-12));
+    REQUIRE(step.max == Approx(1.0));
+  }
+
+  SECTION("Mean, phase fraction, and interface area")
+  {
+    // The mean is the integral over the domain volume of 2
+    const auto &ramp = statistics.at(0);
+    REQUIRE(ramp.mean.size() == 1);
+    REQUIRE(ramp.mean[0] == Approx(0.5));
+
+    // By the coarea formula, the integral of the gradient magnitude is the length of
+    // each level set, 1, over the range of the field, 1
+    REQUIRE(ramp.interface_area == Approx(1.0));
+
+    // The step has the same interface length, concentrated in one column of cells
+    const auto &step = statistics.at(1);
+    REQUIRE(step.mean[0] == Approx(0.9375 / 2.0));
+    REQUIRE(step.interface_area == Approx(1.0));
+
+    // The phase is where the step exceeds the default threshold of 0.5. It holds the
+    // support points right of x = 1, whose quadrature weights add up to the integral.
+    REQUIRE(step.phase_fraction == Approx(0.9375 / 2.0));
+    REQUIRE(ramp.phase_fraction == Approx(step.phase_fraction));
+  }
+}
+
+PRISMS_PF_END_NAMESPACE
@@ -1,5 +1,16 @@
 // SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
 // SPDX-License-Identifier: GNU Lesser General Public Version 2.1
 
-#define CATCH_CONFIG_MAIN
-#include "catch.hpp"
\ No newline at end of file
+#include <deal.II/base/mpi.h>
+
+#define CATCH_CONFIG_RUNNER
+#include "catch.hpp"
+
+int
+main(int argc, char *argv[])
+{
+  // Some tests use distributed vectors and meshes, so MPI is initialized for all of them
+  dealii::Utilities::MPI::MPI_InitFinalize mpi_init(argc, argv, 1);
+
+  return Catch::Session().run(argc, argv);
+}
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <prismspf/solvers/anderson_acceleration.h>
+
+#include <prismspf/config.h>
+
+#include <array>
+#include <vector>
+
+#include "catch.hpp"
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+  // The linear contraction G(x) = A x + b with A = diag(0.9, 0.5, -0.8) and b = 1. Its
+  // fixed point is x = (10, 2, 1/1.8).
+  const std::array<double, 3> diagonal = {0.9, 0.5, -0.8};
+
+  void
+  apply_map(const VectorType &src, VectorType &dst)
+  {
+    for (unsigned int i = 0; i < diagonal.size(); i++)
+      {
+        dst[i] = (diagonal[i] * src[i]) + 1.0;
+      }
+  }
+
+  // Iterate the map from zero with the given depth until the fixed-point residual drops
+  // below the tolerance, returning the number of iterations.
+  unsigned int
+  count_iterations(unsigned int depth, double mixing, VectorType &solution)
+  {
+    AndersonAcceleration<double> anderson(depth, mixing);
+
+    std::vector<VectorType> old_iterate(1, VectorType(diagonal.size()));
+    VectorType              iterate(diagonal.size());
+    solution.reinit(diagonal.size());
+
+    const unsigned int max_iterations = 1000;
+    for (unsigned int iteration = 1; iteration <= max_iterations; iteration++)
+      {
+        old_iterate[0] = solution;
+        apply_map(solution, iterate);
+        anderson.apply(old_iterate, {&iterate});
+        solution = iterate;
+
+        if (anderson.get_residual_l2_norm() < 1.0e-10)
+          {
+            return iteration;
+          }
+      }
+    return max_iterations;
+  }
+} // namespace
+
+/**
+ * @brief Test the Anderson acceleration of a fixed-point iteration.
+ */
+TEST_CASE("Anderson acceleration")
+{
+  SECTION("Convergence on a linear map")
+  {
+    VectorType picard_solution;
+    VectorType anderson_solution;
+    VectorType damped_solution;
+
+    // With a depth of zero this is a plain Picard iteration, which is limited by the
+    // contraction factor of 0.9
+    const unsigned int picard_iterations = count_iterations(0, 1.0, picard_solution);
+    const unsigned int anderson_iterations =
+      count_iterations(3, 1.0, anderson_solution);
+    const unsigned int damped_iterations = count_iterations(3, 0.5, damped_solution);
+
+    REQUIRE(picard_iterations > 100);
+    REQUIRE(picard_iterations < 1000);
+    REQUIRE(anderson_iterations < 20);
+    REQUIRE(anderson_iterations < picard_iterations);
+    REQUIRE(damped_iterations < picard_iterations);
+
+    const std::array<double, 3> fixed_point = {10.0, 2.0, 1.0 / 1.8};
+    for (unsigned int i = 0; i < fixed_point.size(); i++)
+      {
+        REQUIRE(picard_solution[i] == Approx(fixed_point[i]).epsilon(1.0e-8));
+        REQUIRE(anderson_solution[i] == Approx(fixed_point[i]).epsilon(1.0e-8));
+        REQUIRE(damped_solution[i] == Approx(fixed_point[i]).epsilon(1.0e-8));
+      }
+  }
+  SECTION("Restart on residual growth")
+  {
+    AndersonAcceleration<double> anderson(3, 1.0);
+
+    std::vector<VectorType> old_iterate(1, VectorType(diagonal.size()));
+    VectorType              iterate(diagonal.size());
+
+    // The first step has no history, so the iterate is the plain sweep
+    apply_map(old_iterate[0], iterate);
+    anderson.apply(old_iterate, {&iterate});
+    REQUIRE(anderson.get_history_size() == 0);
+    REQUIRE(iterate[0] == 1.0);
+
+    // The residual decreases, so the step is added to the history
+    old_iterate[0] = iterate;
+    apply_map(old_iterate[0], iterate);
+    anderson.apply(old_iterate, {&iterate});
+    REQUIRE(anderson.get_history_size() == 1);
+
+    // A sweep with a larger residual clears the history and is not accelerated
+    const double previous_residual_norm = anderson.get_residual_l2_norm();
+    old_iterate[0]                      = 0.0;
+    iterate                             = 10.0;
+    anderson.apply(old_iterate, {&iterate});
+    REQUIRE(anderson.get_residual_l2_norm() > previous_residual_norm);
+    REQUIRE(anderson.get_history_size() == 0);
+    for (unsigned int i = 0; i < diagonal.size(); i++)
+      {
+        REQUIRE(iterate[i] == 10.0);
+      }
+
+    // Clearing the accelerator also resets the residual
+    anderson.clear();
+    REQUIRE(anderson.get_history_size() == 0);
+    REQUIRE(anderson.get_residual_l2_norm() == 0.0);
+  }
+}
+
+PRISMS_PF_END_NAMESPACE
@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/point.h>
+#include <deal.II/base/vectorization.h>
+
+#include <prismspf/core/type_enums.h>
+#include <prismspf/core/types.h>
+#include <prismspf/core/variable_attribute_loader.h>
+#include <prismspf/core/variable_container.h>
+
+#include <prismspf/solvers/concurrent_explicit_postprocess_solver.h>
+
+#include <prismspf/config.h>
+
+#include <string>
+
+#include "catch.hpp"
+#include "test_problem.h"
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  // A 3 x 2 domain with only 3 cells. The cell batches are partially filled for any
+  // vectorization width, and when the tests run on more than 3 processes, some of them
+  // own no cells.
+  const std::string parameters = R"(
+set dim = 2
+set global refinement = 0
+set degree = 1
+
+subsection Rectangular mesh
+  set x size = 3.0
+  set y size = 2.0
+  set x subdivisions = 3
+  set y subdivisions = 1
+end
+
+set time step = 1.0
+set number steps = 1
+
+subsection output
+  set condition = EQUAL_SPACING
+  set number = 1
+end
+
+set boundary condition for n = Natural
+)";
+
+  // The constant of the minimum and maximum reductions
+  constexpr double constant = 2.5;
+
+  class testVariableAttributeLoader : public VariableAttributeLoader
+  {
+  public:
+    ~testVariableAttributeLoader() override = default;
+
+    void
+    load_variable_attributes() override
+    {
+      set_variable_name(0, "n");
+      set_variable_type(0, Scalar);
+      set_variable_equation_type(0, ExplicitTimeDependent);
+      set_dependencies_value_term_rhs(0, "n");
+      set_dependencies_gradient_term_rhs(0, "");
+
+      set_variable_name(1, "f");
+      set_variable_type(1, Scalar);
+      set_variable_equation_type(1, ExplicitTimeDependent);
+      set_is_postprocessed_field(1, true);
+      set_dependencies_value_term_rhs(1, "n");
+      set_dependencies_gradient_term_rhs(1, "");
+    }
+  };
+
+  // The field n = x and a postprocess kernel that reduces a constant and n
+  template <unsigned int dim, unsigned int degree, typename number>
+  class testPDE : public TestPDE<dim, degree, number>
+  {
+  public:
+    using SizeType = dealii::VectorizedArray<number>;
+
+    using TestPDE<dim, degree, number>::TestPDE;
+
+    void
+    set_initial_condition(const unsigned int                        &index,
+                          [[maybe_unused]] const unsigned int       &component,
+                          const dealii::Point<dim>                  &point,
+                          number                                    &scalar_value,
+                          [[maybe_unused]] number &vector_component_value) const override
+    {
+      if (index == 0)
+        {
+          scalar_value = point[0];
+        }
+    }
+
+    void
+    compute_postprocess_explicit_rhs(
+      VariableContainer<dim, degree, number>             &variable_list,
+      [[maybe_unused]] const dealii::Point<dim, SizeType> &q_point_loc,
+      [[maybe_unused]] const SizeType                     &element_volume,
+      [[maybe_unused]] Types::Index                        solve_block) const override
+    {
+      const SizeType n = variable_list.template get_value<SizeType>(0);
+
+      variable_list.set_value_term(1, n);
+      variable_list.add_reduction("volume", SizeType(1.0));
+      variable_list.add_reduction("integral", n);
+      variable_list.add_reduction("min", SizeType(constant), ReductionType::Minimum);
+      variable_list.add_reduction("max", SizeType(constant), ReductionType::Maximum);
+    }
+  };
+
+  // The same field with a postprocess kernel that registers no reductions
+  template <unsigned int dim, unsigned int degree, typename number>
+  class testPDENoReductions : public testPDE<dim, degree, number>
+  {
+  public:
+    using SizeType = dealii::VectorizedArray<number>;
+
+    using testPDE<dim, degree, number>::testPDE;
+
+    void
+    compute_postprocess_explicit_rhs(
+      VariableContainer<dim, degree, number>             &variable_list,
+      [[maybe_unused]] const dealii::Point<dim, SizeType> &q_point_loc,
+      [[maybe_unused]] const SizeType                     &element_volume,
+      [[maybe_unused]] Types::Index                        solve_block) const override
+    {
+      variable_list.set_value_term(1, variable_list.template get_value<SizeType>(0));
+    }
+  };
+} // namespace
+
+/**
+ * @brief Test the named reductions of a postprocess kernel. The sums are weighted by
+ * JxW, so the sum of 1 is the volume of the domain. The result must be the same on every
+ * process, whatever the vectorization width and the cells each process owns.
+ */
+TEST_CASE("Postprocess reductions")
+{
+  testVariableAttributeLoader attribute_loader;
+  TestProblem<2, 1, testPDE>  problem(attribute_loader,
+                                     parameters,
+                                     "concurrent_explicit_postprocess_solver.prm");
+
+  ConcurrentExplicitPostprocessSolver<2, 1, double> solver(problem.solver_context, 0);
+  solver.init();
+  solver.solve();
+
+  // Solving again gives the same reductions rather than accumulating them
+  for (unsigned int solve = 0; solve < 2; solve++)
+    {
+      const auto reductions = solver.get_reductions();
+      REQUIRE(reductions.size() == 4);
+      REQUIRE(reductions.at("volume") == Approx(6.0));
+      REQUIRE(reductions.at("integral") == Approx(9.0));
+      REQUIRE(reductions.at("min") == constant);
+      REQUIRE(reductions.at("max") == constant);
+
+      solver.solve();
+    }
+}
+
+/**
+ * @brief Test that a postprocess kernel without reductions has none, which skips their
+ * collectives.
+ */
+TEST_CASE("Postprocess without reductions")
+{
+  testVariableAttributeLoader            attribute_loader;
+  TestProblem<2, 1, testPDENoReductions> problem(
+    attribute_loader,
+    parameters,
+    "concurrent_explicit_postprocess_solver_no_reductions.prm");
+
+  ConcurrentExplicitPostprocessSolver<2, 1, double> solver(problem.solver_context, 0);
+  solver.init();
+  solver.solve();
+  REQUIRE(solver.get_reductions().empty());
+}
+
+PRISMS_PF_END_NAMESPACE
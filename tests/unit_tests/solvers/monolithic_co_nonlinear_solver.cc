@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/point.h>
+#include <deal.II/base/vectorization.h>
+
+#include <prismspf/core/type_enums.h>
+#include <prismspf/core/types.h>
+#include <prismspf/core/variable_attribute_loader.h>
+#include <prismspf/core/variable_container.h>
+
+#include <prismspf/solvers/monolithic_co_nonlinear_solver.h>
+
+#include <prismspf/config.h>
+
+#include <string>
+
+#include "catch.hpp"
+#include "test_problem.h"
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  // The unit square with 4 x 4 cells. The Newton iterations are capped at 6, which is
+  // enough for Newton's method on the coupled system but not for a Newton method that
+  // only has the diagonal blocks of the Jacobian.
+  const std::string parameters = R"(
+set dim = 2
+set global refinement = 2
+set degree = 1
+
+subsection Rectangular mesh
+  set x size = 1.0
+  set y size = 1.0
+  set x subdivisions = 1
+  set y subdivisions = 1
+end
+
+set time step = 1.0
+set number steps = 1
+
+subsection output
+  set condition = EQUAL_SPACING
+  set number = 1
+end
+
+set boundary condition for u = Natural
+set boundary condition for v = Natural
+
+set use monolithic co-nonlinear solve = true
+set monolithic linear tolerance = 1.0e-10
+set monolithic linear restart length = 10
+
+subsection linear solver parameters: u
+  set preconditioner type = None
+end
+subsection linear solver parameters: v
+  set preconditioner type = None
+end
+
+subsection nonlinear solver parameters: u
+  set max iterations = 6
+  set tolerance type = AbsoluteResidual
+  set tolerance value = 1.0e-12
+end
+subsection nonlinear solver parameters: v
+  set max iterations = 6
+  set tolerance type = AbsoluteResidual
+  set tolerance value = 1.0e-12
+end
+)";
+
+  class testVariableAttributeLoader : public VariableAttributeLoader
+  {
+  public:
+    ~testVariableAttributeLoader() override = default;
+
+    void
+    load_variable_attributes() override
+    {
+      set_variable_name(0, "u");
+      set_variable_type(0, Scalar);
+      set_variable_equation_type(0, TimeIndependent);
+      set_dependencies_value_term_rhs(0, "u, v");
+      set_dependencies_gradient_term_rhs(0, "");
+      set_dependencies_value_term_lhs(0, "u, change(u)");
+      set_dependencies_gradient_term_lhs(0, "");
+
+      set_variable_name(1, "v");
+      set_variable_type(1, Scalar);
+      set_variable_equation_type(1, TimeIndependent);
+      set_dependencies_value_term_rhs(1, "u, v");
+      set_dependencies_gradient_term_rhs(1, "");
+      set_dependencies_value_term_lhs(1, "v, change(v)");
+      set_dependencies_gradient_term_lhs(1, "");
+    }
+  };
+
+  // The coupled equations u^3 + v = 3 and v^3 = 4 u + 4, whose solution is u = 1 and
+  // v = 2. There are only value terms, so with the Gauss-Lobatto quadrature the equations
+  // hold at each DoF. The LHS is the diagonal block of the Jacobian of each field.
+  template <unsigned int dim, unsigned int degree, typename number>
+  class testPDE : public TestPDE<dim, degree, number>
+  {
+  public:
+    using SizeType = dealii::VectorizedArray<number>;
+
+    using TestPDE<dim, degree, number>::TestPDE;
+
+    void
+    set_initial_condition([[maybe_unused]] const unsigned int       &index,
+                          [[maybe_unused]] const unsigned int       &component,
+                          [[maybe_unused]] const dealii::Point<dim> &point,
+                          number                                    &scalar_value,
+                          [[maybe_unused]] number &vector_component_value) const override
+    {
+      scalar_value = 1.5;
+    }
+
+    void
+    compute_nonexplicit_rhs(
+      VariableContainer<dim, degree, number>             &variable_list,
+      [[maybe_unused]] const dealii::Point<dim, SizeType> &q_point_loc,
+      [[maybe_unused]] const SizeType                     &element_volume,
+      [[maybe_unused]] Types::Index                        solve_block,
+      Types::Index                                         index) const override
+    {
+      const SizeType u = variable_list.template get_value<SizeType>(0);
+      const SizeType v = variable_list.template get_value<SizeType>(1);
+
+      if (index == 0)
+        {
+          variable_list.set_value_term(0, 3.0 - (u * u * u) - v);
+        }
+      else if (index == 1)
+        {
+          variable_list.set_value_term(1, (4.0 * u) + 4.0 - (v * v * v));
+        }
+    }
+
+    void
+    compute_nonexplicit_lhs(
+      VariableContainer<dim, degree, number>             &variable_list,
+      [[maybe_unused]] const dealii::Point<dim, SizeType> &q_point_loc,
+      [[maybe_unused]] const SizeType                     &element_volume,
+      [[maybe_unused]] Types::Index                        solve_block,
+      Types::Index                                         index) const override
+    {
+      if (index == 0)
+        {
+          const SizeType u = variable_list.template get_value<SizeType>(0);
+          const SizeType change_u =
+            variable_list.template get_value<SizeType>(0, DependencyType::Change);
+          variable_list.set_value_term(0, 3.0 * u * u * change_u, DependencyType::Change);
+        }
+      else if (index == 1)
+        {
+          const SizeType v = variable_list.template get_value<SizeType>(1);
+          const SizeType change_v =
+            variable_list.template get_value<SizeType>(1, DependencyType::Change);
+          variable_list.set_value_term(1, 3.0 * v * v * change_v, DependencyType::Change);
+        }
+    }
+  };
+} // namespace
+
+/**
+ * @brief Test the Newton iterations of the block system of two co-nonlinear fields. The
+ * Jacobian includes the coupling between the fields, so the solve converges within a few
+ * iterations.
+ */
+TEST_CASE("Monolithic co-nonlinear solver")
+{
+  testVariableAttributeLoader attribute_loader;
+
+  SECTION("Convergence on a coupled problem")
+  {
+    TestProblem<2, 1, testPDE> problem(attribute_loader,
+                                       parameters,
+                                       "monolithic_co_nonlinear_solver.prm");
+
+    MonolithicCoNonlinearSolver<2, 1, double> solver(problem.solver_context, 0);
+    solver.init();
+    solver.solve();
+
+    auto *u = problem.solution_handler.get_solution_vector(0, DependencyType::Normal);
+    auto *v = problem.solution_handler.get_solution_vector(1, DependencyType::Normal);
+    u->add(-1.0);
+    v->add(-2.0);
+    REQUIRE(u->linfty_norm() < 1.0e-8);
+    REQUIRE(v->linfty_norm() < 1.0e-8);
+  }
+
+  SECTION("Fields with different line searches")
+  {
+    // The block system takes one step for both fields
+    const std::string step_parameters = parameters + R"(
+subsection nonlinear solver parameters: v
+  set step size = 0.5
+end
+)";
+    TestProblem<2, 1, testPDE> problem(attribute_loader,
+                                       step_parameters,
+                                       "monolithic_co_nonlinear_solver_step.prm");
+
+    MonolithicCoNonlinearSolver<2, 1, double> solver(problem.solver_context, 0);
+    REQUIRE_THROWS(solver.init());
+  }
+}
+
+PRISMS_PF_END_NAMESPACE
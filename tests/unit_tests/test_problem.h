@@ -0,0 +1,282 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#pragma once
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q1.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <prismspf/core/constraint_handler.h>
+#include <prismspf/core/dof_handler.h>
+#include <prismspf/core/initial_conditions.h>
+#include <prismspf/core/invm_handler.h>
+#include <prismspf/core/matrix_free_handler.h>
+#include <prismspf/core/multigrid_info.h>
+#include <prismspf/core/pde_operator.h>
+#include <prismspf/core/solution_handler.h>
+#include <prismspf/core/triangulation_handler.h>
+#include <prismspf/core/type_enums.h>
+#include <prismspf/core/types.h>
+#include <prismspf/core/variable_attribute_loader.h>
+#include <prismspf/core/variable_attributes.h>
+#include <prismspf/core/variable_container.h>
+
+#include <prismspf/user_inputs/input_file_reader.h>
+#include <prismspf/user_inputs/user_input_parameters.h>
+
+#include <prismspf/solvers/solver_context.h>
+
+#include <prismspf/utilities/element_volume.h>
+
+#include <prismspf/config.h>
+
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mpi.h>
+#include <string>
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+/**
+ * @brief PDE operator with no equations, initial conditions, or boundary conditions.
+ * Tests derive from this to set the parts they need.
+ */
+template <unsigned int dim, unsigned int degree, typename number>
+class TestPDE : public PDEOperator<dim, degree, number>
+{
+public:
+  using SizeType = dealii::VectorizedArray<number>;
+
+  /**
+   * @brief Constructor.
+   */
+  explicit TestPDE(const UserInputParameters<dim> &_user_inputs)
+    : PDEOperator<dim, degree, number>(_user_inputs)
+  {}
+
+  void
+  set_initial_condition([[maybe_unused]] const unsigned int       &index,
+                        [[maybe_unused]] const unsigned int       &component,
+                        [[maybe_unused]] const dealii::Point<dim> &point,
+                        [[maybe_unused]] number                   &scalar_value,
+                        [[maybe_unused]] number &vector_component_value) const override
+  {}
+
+  void
+  set_nonuniform_dirichlet([[maybe_unused]] const unsigned int       &index,
+                           [[maybe_unused]] const unsigned int       &boundary_id,
+                           [[maybe_unused]] const unsigned int       &component,
+                           [[maybe_unused]] const dealii::Point<dim> &point,
+                           [[maybe_unused]] number                   &scalar_value,
+                           [[maybe_unused]] number &vector_component_value) const override
+  {}
+
+  void
+  compute_explicit_rhs(
+    [[maybe_unused]] VariableContainer<dim, degree, number> &variable_list,
+    [[maybe_unused]] const dealii::Point<dim, SizeType>     &q_point_loc,
+    [[maybe_unused]] const SizeType                         &element_volume,
+    [[maybe_unused]] Types::Index                            solve_block) const override
+  {}
+
+  void
+  compute_nonexplicit_rhs(
+    [[maybe_unused]] VariableContainer<dim, degree, number> &variable_list,
+    [[maybe_unused]] const dealii::Point<dim, SizeType>     &q_point_loc,
+    [[maybe_unused]] const SizeType                         &element_volume,
+    [[maybe_unused]] Types::Index                            solve_block,
+    [[maybe_unused]] Types::Index index = Numbers::invalid_index) const override
+  {}
+
+  void
+  compute_nonexplicit_lhs(
+    [[maybe_unused]] VariableContainer<dim, degree, number> &variable_list,
+    [[maybe_unused]] const dealii::Point<dim, SizeType>     &q_point_loc,
+    [[maybe_unused]] const SizeType                         &element_volume,
+    [[maybe_unused]] Types::Index                            solve_block,
+    [[maybe_unused]] Types::Index index = Numbers::invalid_index) const override
+  {}
+
+  void
+  compute_postprocess_explicit_rhs(
+    [[maybe_unused]] VariableContainer<dim, degree, number> &variable_list,
+    [[maybe_unused]] const dealii::Point<dim, SizeType>     &q_point_loc,
+    [[maybe_unused]] const SizeType                         &element_volume,
+    [[maybe_unused]] Types::Index                            solve_block) const override
+  {}
+};
+
+/**
+ * @brief A small problem that is set up like PDEProblem::init_system, without multigrid
+ * or adaptive refinement, for tests of the classes that need a mesh, the matrix-free
+ * object, and the solution vectors.
+ *
+ * The parameters are written to a file and read back like an input file, so only the
+ * entries the test needs have to be given. The initial conditions of the operator are
+ * applied to the solution fields on construction.
+ *
+ * The mesh can be refined before the DoFs are distributed, for tests on adapted meshes.
+ * If a checkpoint filename is given, the mesh and the data attached to it are loaded from
+ * the checkpoint instead, as on a restart, and the solutions can then be loaded with the
+ * checkpoint handler.
+ */
+template <unsigned int dim,
+          unsigned int degree,
+          template <unsigned int, unsigned int, typename> class Operator>
+class TestProblem
+{
+public:
+  using number = double;
+
+  /**
+   * @brief Constructor.
+   */
+  TestProblem(
+    VariableAttributeLoader                                &attribute_loader,
+    const std::string                                      &parameters,
+    const std::string                                      &parameters_filename,
+    const std::function<void(TriangulationHandler<dim> &)> &refine_mesh         = {},
+    const std::string                                      &checkpoint_filename = "")
+    : var_attributes(load_attributes(attribute_loader))
+    , input_file_reader(write_parameters(parameters, parameters_filename),
+                        var_attributes)
+    , user_inputs(input_file_reader, input_file_reader.get_parameter_handler())
+    , pde_operator(std::make_shared<Operator<dim, degree, number>>(user_inputs))
+    , pde_operator_float(std::make_shared<Operator<dim, degree, float>>(user_inputs))
+    , mg_info(user_inputs)
+    , triangulation_handler(user_inputs, mg_info)
+    , constraint_handler(user_inputs, mg_info, pde_operator, pde_operator_float)
+    , matrix_free_container(mg_info)
+    , invm_handler(user_inputs.get_variable_attributes())
+    , solution_handler(user_inputs.get_variable_attributes(), mg_info)
+    , dof_handler(user_inputs, mg_info)
+    , element_volume_container(mg_info)
+    , solver_context(user_inputs,
+                     matrix_free_container,
+                     triangulation_handler,
+                     invm_handler,
+                     constraint_handler,
+                     dof_handler,
+                     mapping,
+                     element_volume_container,
+                     mg_info,
+                     solution_handler,
+                     pde_operator,
+                     pde_operator_float)
+  {
+    const dealii::QGaussLobatto<1> quadrature(degree + 1);
+    for (const auto &[index, variable] : user_inputs.get_variable_attributes())
+      {
+        const unsigned int n_components =
+          variable.get_field_type() == FieldType::Vector ? dim : 1;
+        fe_system.try_emplace(variable.get_field_type(),
+                              dealii::FE_Q<dim>(quadrature),
+                              n_components);
+      }
+
+    triangulation_handler.generate_mesh(checkpoint_filename);
+    if (refine_mesh)
+      {
+        refine_mesh(triangulation_handler);
+      }
+    dof_handler.init(triangulation_handler, fe_system, mg_info);
+    constraint_handler.make_constraints(mapping, dof_handler.get_dof_handlers());
+    matrix_free_container.template reinit<degree, 1>(mapping,
+                                                     dof_handler,
+                                                     constraint_handler,
+                                                     quadrature);
+    solution_handler.init(matrix_free_container);
+    invm_handler.initialize(matrix_free_container.get_matrix_free());
+    invm_handler.compute_invm();
+    element_volume_container.initialize(matrix_free_container);
+    element_volume_container.compute_element_volume();
+
+    // Apply the initial conditions to the solution fields, as the solvers do
+    for (const auto &[index, variable] : user_inputs.get_variable_attributes())
+      {
+        if (variable.is_postprocess())
+          {
+            continue;
+          }
+        dealii::VectorTools::interpolate(
+          mapping,
+          dof_handler.get_dof_handler(index),
+          InitialCondition<dim, degree, number>(index,
+                                                variable.get_field_type(),
+                                                pde_operator),
+          *solution_handler.get_solution_vector(index, DependencyType::Normal));
+      }
+    solution_handler.apply_initial_condition_for_old_fields();
+    solution_handler.update_ghosts();
+  }
+
+  /**
+   * @brief The variable attributes.
+   */
+  std::map<unsigned int, VariableAttributes> var_attributes;
+
+  /**
+   * @brief The reader of the parameters.
+   */
+  InputFileReader input_file_reader;
+
+  /**
+   * @brief The user inputs.
+   */
+  UserInputParameters<dim> user_inputs;
+
+  /**
+   * @brief The PDE operators.
+   */
+  std::shared_ptr<const PDEOperator<dim, degree, number>> pde_operator;
+  std::shared_ptr<const PDEOperator<dim, degree, float>>  pde_operator_float;
+
+  /**
+   * @brief The handlers of the problem, as in PDEProblem.
+   */
+  MGInfo<dim>                                 mg_info;
+  TriangulationHandler<dim>                   triangulation_handler;
+  ConstraintHandler<dim, degree, number>      constraint_handler;
+  MatrixFreeContainer<dim, number>            matrix_free_container;
+  InvmHandler<dim, degree, number>            invm_handler;
+  SolutionHandler<dim, number>                solution_handler;
+  DofHandler<dim>                             dof_handler;
+  std::map<FieldType, dealii::FESystem<dim>>  fe_system;
+  dealii::MappingQ1<dim>                      mapping;
+  ElementVolumeContainer<dim, degree, number> element_volume_container;
+  SolverContext<dim, degree, number>          solver_context;
+
+private:
+  /**
+   * @brief Load the variable attributes.
+   */
+  static std::map<unsigned int, VariableAttributes>
+  load_attributes(VariableAttributeLoader &attribute_loader)
+  {
+    attribute_loader.init_variable_attributes();
+    return attribute_loader.get_var_attributes();
+  }
+
+  /**
+   * @brief Write the parameters to a file on the first process and return its name.
+   */
+  static std::string
+  write_parameters(const std::string &parameters, const std::string &filename)
+  {
+    if (dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+      {
+        std::ofstream file(filename);
+        file << parameters;
+      }
+    MPI_Barrier(MPI_COMM_WORLD);
+    return filename;
+  }
+};
+
+PRISMS_PF_END_NAMESPACE
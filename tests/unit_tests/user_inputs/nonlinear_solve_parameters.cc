@@ -5,6 +5,8 @@
 
 #include <prismspf/config.h>
 
+#include <cmath>
+
 #include "catch.hpp"
 
 PRISMS_PF_BEGIN_NAMESPACE
@@ -57,6 +59,190 @@ TEST_CASE("Nonlinear solve parameters")
     REQUIRE_THROWS(parameters.postprocess_and_validate());
     parameters.clear();
   }
+  SECTION("Backtracking line search")
+  {
+    NonlinearSolverParameters solver_parameters;
+    solver_parameters.use_backtracking_line_search = true;
+    parameters.set_nonlinear_solve_parameters(0, solver_parameters);
+    REQUIRE_NOTHROW(parameters.postprocess_and_validate());
+    parameters.clear();
+
+    solver_parameters.step_size_modifier = 1.0;
+    parameters.set_nonlinear_solve_parameters(0, solver_parameters);
+    REQUIRE_THROWS(parameters.postprocess_and_validate());
+    parameters.clear();
+
+    solver_parameters.step_size_modifier = 0.0;
+    parameters.set_nonlinear_solve_parameters(0, solver_parameters);
+    REQUIRE_THROWS(parameters.postprocess_and_validate());
+    parameters.clear();
+
+    solver_parameters.step_size_modifier            = 0.5;
+    solver_parameters.residual_decrease_coefficient = 0.0;
+    parameters.set_nonlinear_solve_parameters(0, solver_parameters);
+    REQUIRE_THROWS(parameters.postprocess_and_validate());
+    parameters.clear();
+
+    solver_parameters.residual_decrease_coefficient = 1.0;
+    parameters.set_nonlinear_solve_parameters(0, solver_parameters);
+    REQUIRE_THROWS(parameters.postprocess_and_validate());
+    parameters.clear();
+
+    // The line search parameters are only checked if the line search is used
+    solver_parameters.use_backtracking_line_search = false;
+    parameters.set_nonlinear_solve_parameters(0, solver_parameters);
+    REQUIRE_NOTHROW(parameters.postprocess_and_validate());
+    parameters.clear();
+
+    // The line search always needs the updated residual
+    solver_parameters.use_backtracking_line_search = true;
+    REQUIRE(solver_parameters.tolerance_type ==
+            SolverToleranceType::AbsoluteSolutionChange);
+    REQUIRE(solver_parameters.requires_updated_residual());
+
+    // Armijo condition, ‖F(x + λ δx)‖ ≤ (1 - c λ) ‖F(x)‖, with c = 0.5 and ‖F(x)‖ = 1
+    solver_parameters.residual_decrease_coefficient = 0.5;
+    REQUIRE(solver_parameters.is_sufficient_decrease(1.0, 0.4, 1.0));
+    REQUIRE(solver_parameters.is_sufficient_decrease(1.0, 0.5, 1.0));
+    REQUIRE_FALSE(
+      solver_parameters.is_sufficient_decrease(1.0, std::nextafter(0.5, 1.0), 1.0));
+    REQUIRE_FALSE(solver_parameters.is_sufficient_decrease(1.0, 0.6, 1.0));
+
+    // A shorter step requires less of a decrease
+    REQUIRE(solver_parameters.is_sufficient_decrease(0.5, 0.75, 1.0));
+    REQUIRE_FALSE(
+      solver_parameters.is_sufficient_decrease(0.5, std::nextafter(0.75, 1.0), 1.0));
+
+    // The condition scales with the residual norm
+    REQUIRE(solver_parameters.is_sufficient_decrease(0.5, 7.5, 10.0));
+    REQUIRE_FALSE(solver_parameters.is_sufficient_decrease(0.5, 8.0, 10.0));
+
+    // A residual that does not decrease is never sufficient
+    REQUIRE_FALSE(solver_parameters.is_sufficient_decrease(1.0e-3, 1.0, 1.0));
+  }
+  SECTION("Convergence criteria")
+  {
+    NonlinearSolverParameters solver_parameters;
+    solver_parameters.tolerance_value = 1.0e-3;
+    const double tolerance            = solver_parameters.tolerance_value;
+    const double above_tolerance      = std::nextafter(tolerance, 1.0);
+
+    // The Newton update is compared to the tolerance and the residual is ignored
+    solver_parameters.tolerance_type = SolverToleranceType::AbsoluteSolutionChange;
+    REQUIRE_FALSE(solver_parameters.requires_updated_residual());
+    REQUIRE(solver_parameters.is_converged(tolerance, 1.0, 1.0));
+    REQUIRE_FALSE(solver_parameters.is_converged(above_tolerance, 0.0, 1.0));
+    REQUIRE(solver_parameters.is_converged(0.0, 1.0e10, 1.0));
+
+    // The residual is compared to the tolerance and the Newton update is ignored
+    solver_parameters.tolerance_type = SolverToleranceType::AbsoluteResidual;
+    REQUIRE(solver_parameters.requires_updated_residual());
+    REQUIRE(solver_parameters.is_converged(1.0, tolerance, 1.0));
+    REQUIRE_FALSE(solver_parameters.is_converged(0.0, above_tolerance, 1.0));
+    REQUIRE(solver_parameters.is_converged(1.0e10, 0.0, 1.0));
+
+    // The residual is compared to the tolerance times the initial residual
+    solver_parameters.tolerance_type = SolverToleranceType::RelativeResidualChange;
+    REQUIRE(solver_parameters.requires_updated_residual());
+    REQUIRE(solver_parameters.is_converged(1.0, tolerance * 100.0, 100.0));
+    REQUIRE_FALSE(solver_parameters.is_converged(0.0,
+                                                 std::nextafter(tolerance * 100.0, 1.0),
+                                                 100.0));
+    REQUIRE_FALSE(solver_parameters.is_converged(0.0, 1.0e-2, 1.0));
+    REQUIRE(solver_parameters.is_converged(1.0e10, 0.0, 1.0));
+  }
+  SECTION("Eisenstat-Walker forcing terms")
+  {
+    NonlinearSolverParameters solver_parameters;
+    solver_parameters.use_eisenstat_walker = true;
+    parameters.set_nonlinear_solve_parameters(0, solver_parameters);
+    REQUIRE_NOTHROW(parameters.postprocess_and_validate());
+    parameters.clear();
+
+    solver_parameters.initial_forcing_term = 1.0;
+    parameters.set_nonlinear_solve_parameters(0, solver_parameters);
+    REQUIRE_THROWS(parameters.postprocess_and_validate());
+    parameters.clear();
+
+    solver_parameters.initial_forcing_term = 0.5;
+    solver_parameters.forcing_term_alpha   = 1.0;
+    parameters.set_nonlinear_solve_parameters(0, solver_parameters);
+    REQUIRE_THROWS(parameters.postprocess_and_validate());
+    parameters.clear();
+
+    solver_parameters.forcing_term_alpha = 2.0;
+    solver_parameters.forcing_term_gamma = 0.9;
+
+    // The first iteration uses the initial forcing term
+    REQUIRE(solver_parameters.compute_forcing_term(1.0, 0.0, 0.0) == 0.5);
+
+    // Fast residual decrease with a small previous forcing term tightens the tolerance
+    REQUIRE(solver_parameters.compute_forcing_term(1.0e-2, 1.0, 0.1) ==
+            Approx(0.9 * 1.0e-4));
+
+    // The safeguard keeps the forcing term from dropping too quickly
+    REQUIRE(solver_parameters.compute_forcing_term(1.0e-2, 1.0, 0.5) ==
+            Approx(0.9 * 0.25));
+
+    // The forcing term is capped by the max forcing term
+    REQUIRE(solver_parameters.compute_forcing_term(2.0, 1.0, 0.5) ==
+            Approx(solver_parameters.max_forcing_term));
+  }
+  SECTION("Anderson acceleration")
+  {
+    REQUIRE(parameters.get_anderson_depth() == 0);
+
+    parameters.set_anderson_acceleration_parameters(5, 0.5);
+    REQUIRE_NOTHROW(parameters.postprocess_and_validate());
+    REQUIRE(parameters.get_anderson_depth() == 5);
+    REQUIRE(parameters.get_anderson_mixing() == 0.5);
+
+    parameters.set_anderson_acceleration_parameters(5, 0.0);
+    REQUIRE_THROWS(parameters.postprocess_and_validate());
+
+    parameters.set_anderson_acceleration_parameters(0, 1.0);
+  }
+  SECTION("Monolithic co-nonlinear solve")
+  {
+    REQUIRE_FALSE(parameters.get_use_monolithic_solve());
+
+    parameters.set_monolithic_parameters(true, 1.0e-4, 50, 20);
+    REQUIRE_NOTHROW(parameters.postprocess_and_validate());
+    REQUIRE(parameters.get_use_monolithic_solve());
+    REQUIRE(parameters.get_monolithic_linear_tolerance() == 1.0e-4);
+    REQUIRE(parameters.get_monolithic_linear_iterations() == 50);
+    REQUIRE(parameters.get_monolithic_linear_restart() == 20);
+
+    parameters.set_monolithic_parameters(true, 1.0, 50, 20);
+    REQUIRE_THROWS(parameters.postprocess_and_validate());
+
+    parameters.set_monolithic_parameters(true, 1.0e-4, 50, 0);
+    REQUIRE_THROWS(parameters.postprocess_and_validate());
+
+    parameters.set_monolithic_parameters(false, 1.0e-6, 200, 50);
+  }
+  SECTION("Shared line search")
+  {
+    NonlinearSolverParameters first;
+    NonlinearSolverParameters second;
+    REQUIRE(first.has_same_line_search(second));
+
+    // The backtracking parameters only matter when backtracking is used
+    second.step_size_modifier = 0.25;
+    REQUIRE(first.has_same_line_search(second));
+
+    first.use_backtracking_line_search = true;
+    REQUIRE_FALSE(first.has_same_line_search(second));
+
+    second.use_backtracking_line_search = true;
+    REQUIRE_FALSE(first.has_same_line_search(second));
+
+    second.step_size_modifier = first.step_size_modifier;
+    REQUIRE(first.has_same_line_search(second));
+
+    second.step_length = 0.5;
+    REQUIRE_FALSE(first.has_same_line_search(second));
+  }
 }
 
 PRISMS_PF_END_NAMESPACE
\ No newline at end of file
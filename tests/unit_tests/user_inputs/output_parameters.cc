@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <prismspf/core/type_enums.h>
+#include <prismspf/core/variable_attribute_loader.h>
+#include <prismspf/core/variable_attributes.h>
+
+#include <prismspf/user_inputs/output_parameters.h>
+#include <prismspf/user_inputs/temporal_discretization.h>
+
+#include <prismspf/config.h>
+
+#include <map>
+
+#include "catch.hpp"
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  // A field and a postprocessed field, either of which can be left out of the output
+  class testVariableAttributeLoader : public VariableAttributeLoader
+  {
+  public:
+    testVariableAttributeLoader(bool _output_field, bool _output_postprocessed_field)
+      : output_field(_output_field)
+      , output_postprocessed_field(_output_postprocessed_field)
+    {}
+
+    ~testVariableAttributeLoader() override = default;
+
+    void
+    load_variable_attributes() override
+    {
+      set_variable_name(0, "n");
+      set_variable_type(0, Scalar);
+      set_variable_equation_type(0, ExplicitTimeDependent);
+      set_is_output_field(0, output_field);
+      set_dependencies_value_term_rhs(0, "n");
+      set_dependencies_gradient_term_rhs(0, "");
+
+      set_variable_name(1, "f");
+      set_variable_type(1, Scalar);
+      set_variable_equation_type(1, ExplicitTimeDependent);
+      set_is_postprocessed_field(1, true);
+      set_is_output_field(1, output_postprocessed_field);
+      set_dependencies_value_term_rhs(1, "n");
+      set_dependencies_gradient_term_rhs(1, "");
+    }
+
+  private:
+    bool output_field;
+    bool output_postprocessed_field;
+  };
+
+  std::map<unsigned int, VariableAttributes>
+  load_attributes(bool output_field, bool output_postprocessed_field)
+  {
+    testVariableAttributeLoader attribute_loader(output_field,
+                                                 output_postprocessed_field);
+    attribute_loader.init_variable_attributes();
+    return attribute_loader.get_var_attributes();
+  }
+} // namespace
+
+/**
+ * @brief Test the validation of the output parameters.
+ */
+TEST_CASE("Output parameters")
+{
+  const TemporalDiscretization                     temporal_discretization;
+  const std::map<unsigned int, VariableAttributes> var_attributes =
+    load_attributes(true, true);
+  const unsigned int                               dim = 2;
+
+  SECTION("Asynchronous output")
+  {
+    OutputParameters parameters;
+    parameters.set_asynchronous_output(true);
+
+    // The background thread can write the file types that do not communicate
+    parameters.set_file_type("pvtu");
+    REQUIRE_NOTHROW(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+
+    parameters.set_file_type("vtk");
+    REQUIRE_NOTHROW(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+
+    // A single vtu file is written collectively by all processes
+    parameters.set_file_type("vtu");
+    REQUIRE_THROWS(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+
+    // Without asynchronous output any file type can be used
+    parameters.set_asynchronous_output(false);
+    REQUIRE_NOTHROW(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+  }
+  SECTION("HDF5 output")
+  {
+    OutputParameters parameters;
+    parameters.set_file_type("hdf5");
+#ifdef PRISMS_PF_WITH_HDF5
+    REQUIRE_NOTHROW(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+#else
+    REQUIRE_THROWS(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+#endif
+
+    // The hdf5 file is written collectively, so it cannot be written in the background
+    parameters.set_asynchronous_output(true);
+    REQUIRE_THROWS(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+  }
+  SECTION("Output region")
+  {
+    OutputParameters parameters;
+    parameters.set_file_type("vtu");
+
+    // Without corners the whole domain is written
+    REQUIRE_FALSE(parameters.has_output_region());
+    REQUIRE_NOTHROW(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+
+    parameters.set_output_region({0.0, 0.0}, {1.0, 2.0});
+    REQUIRE(parameters.has_output_region());
+    REQUIRE_NOTHROW(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+
+    // A region that is flat in one direction is allowed
+    parameters.set_output_region({0.0, 1.0}, {1.0, 1.0});
+    REQUIRE_NOTHROW(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+
+    // The lower corner must be below the upper corner in every direction
+    parameters.set_output_region({0.0, 2.0}, {1.0, 1.0});
+    REQUIRE_THROWS(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+
+    // The corners must have one coordinate per dimension
+    parameters.set_output_region({0.0, 0.0, 0.0}, {1.0, 1.0, 1.0});
+    REQUIRE_THROWS(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+
+    parameters.set_output_region({0.0, 0.0}, {1.0});
+    REQUIRE_THROWS(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+
+    parameters.set_output_region({}, {1.0, 1.0});
+    REQUIRE_THROWS(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+  }
+  SECTION("Higher order cells")
+  {
+    OutputParameters parameters;
+    parameters.set_write_higher_order_cells(true);
+    REQUIRE(parameters.get_write_higher_order_cells());
+
+    // Lagrange cells are written by all of the VTK formats
+    for (const auto *file_type : {"vtu", "pvtu", "vtk"})
+      {
+        parameters.set_file_type(file_type);
+        REQUIRE_NOTHROW(parameters.postprocess_and_validate(temporal_discretization,
+                                                            dim,
+                                                            var_attributes));
+      }
+
+    parameters.set_file_type("hdf5");
+    REQUIRE_THROWS(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+  }
+  SECTION("Compression level")
+  {
+    OutputParameters parameters;
+    parameters.set_file_type("vtu");
+    REQUIRE(parameters.get_compression_level() ==
+            dealii::DataOutBase::CompressionLevel::best_speed);
+
+    for (const auto compression_level :
+         {dealii::DataOutBase::CompressionLevel::no_compression,
+          dealii::DataOutBase::CompressionLevel::best_speed,
+          dealii::DataOutBase::CompressionLevel::default_compression,
+          dealii::DataOutBase::CompressionLevel::best_compression})
+      {
+        parameters.set_compression_level(compression_level);
+        REQUIRE_NOTHROW(parameters.postprocess_and_validate(temporal_discretization,
+                                                            dim,
+                                                            var_attributes));
+        REQUIRE(parameters.get_compression_level() == compression_level);
+      }
+  }
+  SECTION("Output fields")
+  {
+    OutputParameters parameters;
+    parameters.set_file_type("vtu");
+    REQUIRE_NOTHROW(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+    parameters.set_postprocessed_only(true);
+    REQUIRE_NOTHROW(
+      parameters.postprocess_and_validate(temporal_discretization, dim, var_attributes));
+
+    // Without the postprocessed field, only the other field can be written
+    const auto masked_attributes = load_attributes(true, false);
+    REQUIRE_THROWS(parameters.postprocess_and_validate(temporal_discretization,
+                                                       dim,
+                                                       masked_attributes));
+    parameters.set_postprocessed_only(false);
+    REQUIRE_NOTHROW(parameters.postprocess_and_validate(temporal_discretization,
+                                                        dim,
+                                                        masked_attributes));
+
+    // With every field masked, only the isosurfaces can be written
+    const auto no_attributes = load_attributes(false, false);
+    REQUIRE_THROWS(
+      parameters.postprocess_and_validate(temporal_discretization, dim, no_attributes));
+    parameters.set_isosurface_fields({"n"});
+    parameters.set_isosurface_values({0.5});
+    parameters.set_isosurfaces_only(true);
+    REQUIRE_NOTHROW(
+      parameters.postprocess_and_validate(temporal_discretization, dim, no_attributes));
+  }
+}
+
+PRISMS_PF_END_NAMESPACE
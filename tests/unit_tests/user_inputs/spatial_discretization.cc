@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <prismspf/core/grid_refiner_criterion.h>
+
+#include <prismspf/user_inputs/spatial_discretization.h>
+
+#include <prismspf/config.h>
+
+#include "catch.hpp"
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+/**
+ * @brief Test the validation of the refinement buffer layers with each marking strategy.
+ */
+TEST_CASE("Spatial discretization")
+{
+  SpatialDiscretization<2> parameters;
+  parameters.set_size(0, 1.0);
+  parameters.set_size(1, 1.0);
+  parameters.set_has_adaptivity(true);
+  parameters.set_refinement_buffer_layers(2);
+
+  SECTION("Threshold marking")
+  {
+    parameters.set_marking_strategy(GridRefinement::Threshold);
+    REQUIRE_NOTHROW(parameters.postprocess_and_validate());
+  }
+  SECTION("Fixed fraction marking")
+  {
+    parameters.set_marking_strategy(GridRefinement::FixedFraction);
+    REQUIRE_NOTHROW(parameters.postprocess_and_validate());
+  }
+  SECTION("Fixed number marking")
+  {
+    // The buffer layers would be added after the number of refined cells is fixed
+    parameters.set_marking_strategy(GridRefinement::FixedNumber);
+    REQUIRE_THROWS(parameters.postprocess_and_validate());
+
+    parameters.set_refinement_buffer_layers(0);
+    REQUIRE_NOTHROW(parameters.postprocess_and_validate());
+  }
+}
+
+PRISMS_PF_END_NAMESPACE
@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: © 2025 PRISMS Center at the University of Michigan
+// SPDX-License-Identifier: GNU Lesser General Public Version 2.1
+
+#include <deal.II/base/point.h>
+
+#include <prismspf/core/type_enums.h>
+#include <prismspf/core/variable_attribute_loader.h>
+
+#include <prismspf/utilities/integrator.h>
+
+#include <prismspf/config.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+#include "test_problem.h"
+
+PRISMS_PF_BEGIN_NAMESPACE
+
+namespace
+{
+  // A 2 x 1 domain with 8 x 4 cells
+  const std::string parameters = R"(
+set dim = 2
+set global refinement = 2
+set degree = 1
+
+subsection Rectangular mesh
+  set x size = 2.0
+  set y size = 1.0
+  set x subdivisions = 2
+  set y subdivisions = 1
+end
+
+set time step = 1.0
+set number steps = 1
+
+subsection output
+  set condition = EQUAL_SPACING
+  set number = 1
+end
+
+set boundary condition for n = Natural
+set boundary condition for u, x component = Natural
+set boundary condition for u, y component = Natural
+)";
+
+  class testVariableAttributeLoader : public VariableAttributeLoader
+  {
+  public:
+    ~testVariableAttributeLoader() override = default;
+
+    void
+    load_variable_attributes() override
+    {
+      set_variable_name(0, "n");
+      set_variable_type(0, Scalar);
+      set_variable_equation_type(0, ExplicitTimeDependent);
+      set_dependencies_value_term_rhs(0, "n");
+      set_dependencies_gradient_term_rhs(0, "");
+
+      set_variable_name(1, "u");
+      set_variable_type(1, Vector);
+      set_variable_equation_type(1, ExplicitTimeDependent);
+      set_dependencies_value_term_rhs(1, "u");
+      set_dependencies_gradient_term_rhs(1, "");
+    }
+  };
+
+  // The fields n = 1 + x + 2y and u = (x, xy). Both are interpolated exactly by the
+  // bilinear elements and integrated exactly by the Gauss-Lobatto quadrature.
+  template <unsigned int dim, unsigned int degree, typename number>
+  class testPDE : public TestPDE<dim, degree, number>
+  {
+  public:
+    using TestPDE<dim, degree, number>::TestPDE;
+
+    void
+    set_initial_condition(const unsigned int       &index,
+                          const unsigned int       &component,
+                          const dealii::Point<dim> &point,
+                          number                   &scalar_value,
+                          number                   &vector_component_value) const override
+    {
+      if (index == 0)
+        {
+          scalar_value = 1.0 + point[0] + (2.0 * point[1]);
+        }
+      else
+        {
+          vector_component_value = component == 0 ? point[0] : point[0] * point[1];
+        }
+    }
+  };
+} // namespace
+
+/**
+ * @brief Test the integrals of fields with known values. The result must be the same on
+ * every process, whatever the cells each process owns.
+ */
+TEST_CASE("Integrator")
+{
+  testVariableAttributeLoader attribute_loader;
+  TestProblem<2, 1, testPDE>  problem(attribute_loader, parameters, "integrator.prm");
+
+  Integrator<2, 1, double> integrator;
+  integrator.initialize(problem.matrix_free_container.get_matrix_free());
+
+  auto *n = problem.solution_handler.get_solution_vector(0, DependencyType::Normal);
+  auto *u = problem.solution_handler.get_solution_vector(1, DependencyType::Normal);
+
+  SECTION("Single fields")
+  {
+    double scalar_integral = 0.0;
+    integrator.compute_integral(scalar_integral, 0, *n);
+    REQUIRE(scalar_integral == Approx(6.0));
+
+    std::vector<double> vector_integral(2, 0.0);
+    integrator.compute_integral(vector_integral, 1, *u);
+    REQUIRE(vector_integral[0] == Approx(2.0));
+    REQUIRE(vector_integral[1] == Approx(1.0));
+  }
+
+  SECTION("Several fields at once")
+  {
+    std::map<unsigned int, std::vector<double>> integrals;
+    integrator.compute_integrals(integrals, {{0, n}, {1, u}});
+    REQUIRE(integrals.size() == 2);
+    REQUIRE(integrals.at(0).size() == 1);
+    REQUIRE(integrals.at(0)[0] == Approx(6.0));
+    REQUIRE(integrals.at(1).size() == 2);
+    REQUIRE(integrals.at(1)[0] == Approx(2.0));
+    REQUIRE(integrals.at(1)[1] == Approx(1.0));
+
+    // No fields give no integrals
+    integrator.compute_integrals(integrals, {});
+    REQUIRE(integrals.empty());
+  }
+}
+
+PRISMS_PF_END_NAMESPACE